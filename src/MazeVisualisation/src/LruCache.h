@@ -0,0 +1,152 @@
+//
+// Header File: LruCache.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_LRUCACHE_H
+#define MAZEVISUALISATION_LRUCACHE_H
+
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <utility>
+
+namespace maze {
+
+    //############################################################################//
+    // | LEAST RECENTLY USED CACHE |
+    //############################################################################//
+
+    // Cost bounded cache; each entry carries a cost (usually bytes) and the least recently used
+    // entries are evicted until the total cost fits within the budget. Not thread-safe.
+    template<class Key, class Value, class Hasher = std::hash<Key>>
+    class LruCache {
+
+    public:
+        using EvictCallback = std::function<void(const Key&, Value&)>;
+
+    private:
+        struct Entry {
+            Key    key;
+            Value  value;
+            size_t cost;
+        };
+
+        using EntryList = std::list<Entry>;
+        using EntryMap = std::unordered_map<Key, typename EntryList::iterator, Hasher>;
+
+    private:
+        EntryList     m_Entries;
+        EntryMap      m_Lookup;
+        size_t        m_Budget;
+        size_t        m_TotalCost;
+        EvictCallback m_OnEvict;
+
+    public:
+        explicit LruCache(
+                size_t budget
+        ) : m_Entries(),
+            m_Lookup(),
+            m_Budget(budget),
+            m_TotalCost(0),
+            m_OnEvict() {
+        }
+
+        LruCache(const LruCache&) = delete;
+        LruCache& operator =(const LruCache&) = delete;
+
+    public:
+
+        size_t get_budget() const {
+            return m_Budget;
+        }
+
+        size_t get_total_cost() const {
+            return m_TotalCost;
+        }
+
+        size_t get_size() const {
+            return m_Lookup.size();
+        }
+
+        bool contains(const Key& key) const {
+            return m_Lookup.contains(key);
+        }
+
+        void set_budget(size_t budget) {
+            m_Budget = budget;
+            evict_to_budget();
+        }
+
+        void set_on_evict(EvictCallback cb) {
+            m_OnEvict = std::move(cb);
+        }
+
+        // Returns nullptr when absent, otherwise marks the entry as most recently used
+        Value* find(const Key& key) {
+            auto it = m_Lookup.find(key);
+            if (it == m_Lookup.end()) return nullptr;
+
+            m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+            return &it->second->value;
+        }
+
+        Value& put(const Key& key, Value value, size_t cost) {
+            auto it = m_Lookup.find(key);
+            if (it != m_Lookup.end()) {
+                m_TotalCost -= it->second->cost;
+                m_Entries.erase(it->second);
+                m_Lookup.erase(it);
+            }
+
+            m_Entries.push_front(Entry{ key, std::move(value), cost });
+            m_Lookup.emplace(key, m_Entries.begin());
+            m_TotalCost += cost;
+
+            // The newest entry is never evicted even if it alone exceeds the budget
+            evict_to_budget(1);
+            return m_Entries.front().value;
+        }
+
+        bool erase(const Key& key) {
+            auto it = m_Lookup.find(key);
+            if (it == m_Lookup.end()) return false;
+
+            m_TotalCost -= it->second->cost;
+            m_Entries.erase(it->second);
+            m_Lookup.erase(it);
+            return true;
+        }
+
+        void clear() {
+            if (m_OnEvict) {
+                for (Entry& e : m_Entries) m_OnEvict(e.key, e.value);
+            }
+            m_Entries.clear();
+            m_Lookup.clear();
+            m_TotalCost = 0;
+        }
+
+        template<class Function>
+        void for_each(Function fn) {
+            for (Entry& e : m_Entries) fn(e.key, e.value);
+        }
+
+    private:
+        void evict_to_budget(size_t keep = 0) {
+            while (m_TotalCost > m_Budget && m_Entries.size() > keep) {
+                Entry& last = m_Entries.back();
+                if (m_OnEvict) m_OnEvict(last.key, last.value);
+
+                m_TotalCost -= last.cost;
+                m_Lookup.erase(last.key);
+                m_Entries.pop_back();
+            }
+        }
+    };
+
+} // maze
+
+#endif
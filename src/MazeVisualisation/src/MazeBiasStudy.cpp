@@ -0,0 +1,220 @@
+//
+// Header File: MazeBiasStudy.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeBiasStudy.h"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace maze {
+
+    //############################################################################//
+    // | METRIC ACCUMULATOR |
+    //############################################################################//
+
+    MetricAccumulator::MetricAccumulator(
+            double range_min,
+            double range_max
+    ) : m_RangeMin(range_min),
+        m_RangeMax(range_max),
+        m_Count(0),
+        m_Mean(0.0),
+        m_SquaredDeviation(0.0),
+        m_Min(std::numeric_limits<double>::infinity()),
+        m_Max(-std::numeric_limits<double>::infinity()),
+        m_Bins() {
+        if (!(range_min < range_max)) {
+            HERR("[METRIC]", " # Histogram range [{}, {}) is empty...", range_min, range_max);
+            throw std::exception();
+        }
+    }
+
+    void MetricAccumulator::add(const double value) {
+        ++m_Count;
+        const double delta = value - m_Mean;
+        m_Mean += delta / m_Count;
+        m_SquaredDeviation += delta * (value - m_Mean);
+        m_Min = std::min(m_Min, value);
+        m_Max = std::max(m_Max, value);
+
+        const double position = (value - m_RangeMin) / (m_RangeMax - m_RangeMin) * s_BinCount;
+        const double bin      = std::clamp(position, 0.0, static_cast<double>(s_BinCount - 1));
+        ++m_Bins[static_cast<size_t>(bin)];
+    }
+
+    // Chan et al. pairwise update; both sides must share a range for the bins to line up
+    void MetricAccumulator::merge(const MetricAccumulator& other) {
+        if (m_RangeMin != other.m_RangeMin || m_RangeMax != other.m_RangeMax) {
+            HERR("[METRIC]", " # Cannot merge histograms over different ranges...");
+            throw std::exception();
+        }
+        if (other.m_Count == 0) return;
+
+        const size_t count = m_Count + other.m_Count;
+        const double delta = other.m_Mean - m_Mean;
+        m_SquaredDeviation += other.m_SquaredDeviation
+                              + delta * delta * m_Count * other.m_Count / count;
+        m_Mean += delta * other.m_Count / count;
+        m_Count = count;
+        m_Min   = std::min(m_Min, other.m_Min);
+        m_Max   = std::max(m_Max, other.m_Max);
+        for (size_t i = 0; i < s_BinCount; ++i) m_Bins[i] += other.m_Bins[i];
+    }
+
+    std::string MetricAccumulator::to_json() const {
+        std::string bins{ "[" };
+        for (size_t i = 0; i < s_BinCount; ++i) {
+            if (i != 0) bins.append(",");
+            bins.append(std::format("{}", m_Bins[i]));
+        }
+        bins.append("]");
+
+        return std::format(
+                "{{\"count\":{},\"mean\":{:.6f},\"stddev\":{:.6f},\"min\":{:.6f},\"max\":{:.6f},"
+                "\"range\":[{},{}],\"bins\":{}}}",
+                m_Count, m_Mean, std::sqrt(get_variance()),
+                m_Count == 0 ? 0.0 : m_Min, m_Count == 0 ? 0.0 : m_Max,
+                m_RangeMin, m_RangeMax, bins
+        );
+    }
+
+    //############################################################################//
+    // | GENERATOR BIAS STUDY |
+    //############################################################################//
+
+    std::string GeneratorBias::to_json() const {
+        return std::format(
+                "{{\"generator\":\"{}\",\"rows\":{},\"cols\":{},\"mazes\":{},\"seconds\":{:.3f},"
+                "\"mazes_per_hour\":{:.0f},\"dead_end_ratio\":{},\"mean_corridor_length\":{},"
+                "\"solution_length\":{}}}",
+                generator, bounds.row, bounds.col, maze_count, seconds, get_mazes_per_hour(),
+                dead_end_ratio.to_json(), mean_corridor_length.to_json(), solution_length.to_json()
+        );
+    }
+
+    // Mazes per unit of work; fixed so that merging the chunks in order does not depend on the
+    // thread count. Calibration covers the mazes of the first chunk.
+    inline static constexpr size_t s_BiasStudyChunk = 256;
+
+    // Builds & analyses mazes [begin, end) into 'out'
+    static void study_mazes(
+            const size_t generator,
+            const Index2D bounds,
+            const uint64_t seed,
+            const size_t begin,
+            const size_t end,
+            GeneratorBias& out
+    ) {
+        // Single threaded analysis; the pool's threads are already busy with mazes
+        ThreadPool    serial{ 1 };
+        MazeAnalyser  analyser{ serial };
+        Maze2D        maze{ bounds.row, bounds.col };
+        MazeGenerator builder = get_maze_generator(generator);
+
+        for (size_t i = begin; i < end; ++i) {
+            AbstractMazeGenerator::seed_random(bias_study_maze_seed(seed, i));
+            maze.reset();
+            builder->reset();
+            builder->init_once(maze);
+            while (!builder->is_complete()) builder->step(maze);
+
+            const MazeStatistics stats = analyser.analyse(maze);
+            out.dead_end_ratio.add(stats.get_dead_end_ratio());
+            out.mean_corridor_length.add(stats.get_mean_corridor_length());
+            out.solution_length.add(static_cast<double>(stats.solution_length));
+            ++out.maze_count;
+        }
+    }
+
+    // Range covering the calibration values with half their spread again either side, kept
+    // within [lower, upper]; a single repeated value gets a unit wide range
+    static MetricAccumulator fitted_range(
+            const MetricAccumulator& calibration,
+            const double lower,
+            const double upper
+    ) {
+        if (calibration.get_count() == 0) return MetricAccumulator{ lower, upper };
+
+        const double spread = calibration.get_max() - calibration.get_min();
+        const double margin = spread > 0.0 ? spread / 2.0 : 0.5;
+        const double low    = std::max(lower, calibration.get_min() - margin);
+        const double high   = std::min(upper, calibration.get_max() + margin);
+        return MetricAccumulator{ low, std::max(high, low + margin) };
+    }
+
+    GeneratorBias run_bias_study(
+            const size_t generator,
+            const Index2D bounds,
+            const size_t maze_count,
+            const uint64_t seed,
+            ThreadPool& pool
+    ) {
+        if (bounds.row <= 0 || bounds.col <= 0) {
+            HERR("[BIAS_STUDY]", " # Maze size '{}' is invalid...", bounds.to_string());
+            throw std::exception();
+        }
+
+        // A corner to corner path or a single corridor can not be longer than the cell count
+        const std::string name  = get_maze_generator(generator)->get_display_name();
+        const auto        cells = static_cast<double>(bounds.size());
+        const auto        start = std::chrono::steady_clock::now();
+        const size_t      first = std::min(maze_count, s_BiasStudyChunk);
+
+        // Only the extremes are used from calibration, so how it is split does not matter
+        const GeneratorBias unfitted{
+                name, bounds, 0, 0.0,
+                MetricAccumulator{ 0.0, 1.0 },
+                MetricAccumulator{ 0.0, cells },
+                MetricAccumulator{ 0.0, cells }
+        };
+        const size_t               tasks = std::clamp<size_t>(first, 1, pool.get_thread_count());
+        std::vector<GeneratorBias> calibrations(tasks, unfitted);
+
+        pool.run(tasks, [&](const size_t task) {
+            const size_t begin = first * task / tasks;
+            const size_t end   = first * (task + 1) / tasks;
+            study_mazes(generator, bounds, seed, begin, end, calibrations[task]);
+        });
+
+        GeneratorBias calibration = unfitted;
+        for (const GeneratorBias& part : calibrations) {
+            calibration.dead_end_ratio.merge(part.dead_end_ratio);
+            calibration.mean_corridor_length.merge(part.mean_corridor_length);
+            calibration.solution_length.merge(part.solution_length);
+        }
+
+        const GeneratorBias empty{
+                name, bounds, 0, 0.0,
+                fitted_range(calibration.dead_end_ratio, 0.0, 1.0),
+                fitted_range(calibration.mean_corridor_length, 0.0, cells),
+                fitted_range(calibration.solution_length, 0.0, cells)
+        };
+
+        const size_t               chunks = (maze_count + s_BiasStudyChunk - 1) / s_BiasStudyChunk;
+        std::vector<GeneratorBias> partial(chunks, empty);
+
+        pool.run(chunks, [&](const size_t chunk) {
+            const size_t begin = chunk * s_BiasStudyChunk;
+            const size_t end   = std::min(maze_count, begin + s_BiasStudyChunk);
+            study_mazes(generator, bounds, seed, begin, end, partial[chunk]);
+        });
+
+        GeneratorBias result = empty;
+        for (const GeneratorBias& part : partial) {
+            result.maze_count += part.maze_count;
+            result.dead_end_ratio.merge(part.dead_end_ratio);
+            result.mean_corridor_length.merge(part.mean_corridor_length);
+            result.solution_length.merge(part.solution_length);
+        }
+        result.seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start
+        ).count();
+        return result;
+    }
+
+} // maze
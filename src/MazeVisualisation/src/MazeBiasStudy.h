@@ -0,0 +1,121 @@
+//
+// Header File: MazeBiasStudy.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEBIASSTUDY_H
+#define MAZEVISUALISATION_MAZEBIASSTUDY_H
+
+#include "MazeStatistics.h"
+
+namespace maze {
+
+    //############################################################################//
+    // | METRIC ACCUMULATOR |
+    //############################################################################//
+
+    // Streaming summary of one metric: count, mean & variance (Welford) plus a histogram over a
+    // fixed range. Values outside the range land in the first or last bin. Partial results from
+    // separate threads are combined with 'merge'.
+    class MetricAccumulator {
+
+    public:
+        inline static constexpr size_t s_BinCount = 32;
+
+    private:
+        double                         m_RangeMin;
+        double                         m_RangeMax;
+        size_t                         m_Count;
+        double                         m_Mean;
+        double                         m_SquaredDeviation;
+        double                         m_Min;
+        double                         m_Max;
+        std::array<size_t, s_BinCount> m_Bins;
+
+    public:
+        MetricAccumulator(double range_min = 0.0, double range_max = 1.0);
+
+    public:
+        void add(double value);
+        void merge(const MetricAccumulator& other);
+
+        size_t get_count() const {
+            return m_Count;
+        }
+
+        double get_mean() const {
+            return m_Mean;
+        }
+
+        double get_variance() const {
+            return m_Count < 2 ? 0.0 : m_SquaredDeviation / (m_Count - 1);
+        }
+
+        double get_min() const {
+            return m_Min;
+        }
+
+        double get_max() const {
+            return m_Max;
+        }
+
+        const std::array<size_t, s_BinCount>& get_bins() const {
+            return m_Bins;
+        }
+
+        // Lower edge of a bin
+        double get_bin_start(const size_t bin) const {
+            return m_RangeMin + (m_RangeMax - m_RangeMin) * bin / s_BinCount;
+        }
+
+        std::string to_json() const;
+    };
+
+    //############################################################################//
+    // | GENERATOR BIAS STUDY |
+    //############################################################################//
+
+    struct GeneratorBias {
+        std::string       generator;
+        Index2D           bounds;
+        size_t            maze_count;
+        double            seconds;
+        MetricAccumulator dead_end_ratio;
+        MetricAccumulator mean_corridor_length;
+        MetricAccumulator solution_length;
+
+        double get_mazes_per_hour() const {
+            return seconds <= 0.0 ? 0.0 : maze_count * 3600.0 / seconds;
+        }
+
+        std::string to_json() const;
+    };
+
+    // Seed given to the generator before building maze 'maze_index' of a study; seeding
+    // AbstractMazeGenerator with it reproduces that one maze on its own.
+    inline uint64_t bias_study_maze_seed(const uint64_t seed, const size_t maze_index) {
+        return splitmix64(seed ^ maze_index);
+    }
+
+    // Builds 'maze_count' mazes of one size with a single generator across every thread of the
+    // pool & streams each into the accumulators as soon as it is complete; nothing is written
+    // out. Mazes are split into fixed size chunks, each owning one maze, generator & analyser
+    // which are reset between mazes so the steady state does not allocate. The solution runs
+    // corner to corner.
+    //
+    // Histogram ranges are fitted to each metric from a short calibration run over the first
+    // mazes, so they follow the generator & maze size. Every maze is seeded on its own and the
+    // chunks are merged in order, so a seed always gives the same results on any thread count.
+    GeneratorBias run_bias_study(
+            size_t generator,
+            Index2D bounds,
+            size_t maze_count,
+            uint64_t seed = 0,
+            ThreadPool& pool = ThreadPool::get_shared()
+    );
+
+} // maze
+
+#endif
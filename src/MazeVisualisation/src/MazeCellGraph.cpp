@@ -0,0 +1,111 @@
+//
+// Header File: MazeCellGraph.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeCellGraph.h"
+
+namespace maze {
+
+    CellGraph::CellGraph(
+            ThreadPool& pool
+    ) : m_Pool(pool),
+        m_Bounds{ 0, 0 },
+        m_Offsets(),
+        m_Neighbours(),
+        m_BandOffsets() {
+    }
+
+    uint32_t CellGraph::neighbour_mask(const Maze2D& maze, const Index row, const Index col) {
+        const Cell* data = maze.get_cell_data();
+        const Index rows = maze.get_row_count();
+        const Index cols = maze.get_col_count();
+        const Index flat = row * cols + col;
+        const Cell  cell = data[flat];
+
+        uint32_t mask = 0;
+        if (row > 0 && is_set<Flag::PATH_NORTH>(cell)
+            && is_set<Flag::PATH_SOUTH>(data[flat - cols])) {
+            mask |= 1U;
+        }
+        if (col > 0 && is_set<Flag::PATH_WEST>(cell) && is_set<Flag::PATH_EAST>(data[flat - 1])) {
+            mask |= 2U;
+        }
+        if (col + 1 < cols && is_set<Flag::PATH_EAST>(cell)
+            && is_set<Flag::PATH_WEST>(data[flat + 1])) {
+            mask |= 4U;
+        }
+        if (row + 1 < rows && is_set<Flag::PATH_SOUTH>(cell)
+            && is_set<Flag::PATH_NORTH>(data[flat + cols])) {
+            mask |= 8U;
+        }
+        return mask;
+    }
+
+    void CellGraph::build(const Maze2D& maze) {
+        const size_t cells = maze.get_size();
+
+        // Every cell has at most four neighbours, all of which must fit the offsets
+        if (cells > UINT32_MAX / s_CardinalCount) {
+            HERR("[CELL_GRAPH]", " # Maze with {} cells is too large for 32 bit offsets...", cells);
+            throw std::exception();
+        }
+
+        m_Bounds = maze.get_bounds();
+        m_Offsets.resize(cells + 1);
+
+        const Index  rows       = m_Bounds.row;
+        const Index  cols       = m_Bounds.col;
+        const size_t band_count = std::clamp<size_t>(
+                static_cast<size_t>(rows) / s_MinBandRows,
+                1,
+                m_Pool.get_thread_count() * 4
+        );
+        const Index  band_rows  = static_cast<Index>((rows + band_count - 1) / band_count);
+        m_BandOffsets.assign(band_count + 1, 0);
+
+        // Count; degrees are parked in the offsets until the band's start is known
+        m_Pool.run(band_count, [&](const size_t band) {
+            const Index begin = std::min(rows, static_cast<Index>(band) * band_rows);
+            const Index end   = std::min(rows, begin + band_rows);
+            size_t      total = 0;
+            for (Index row = begin; row < end; ++row) {
+                for (Index col = 0; col < cols; ++col) {
+                    const uint32_t degree = std::popcount(neighbour_mask(maze, row, col));
+                    m_Offsets[row * cols + col] = degree;
+                    total += degree;
+                }
+            }
+            m_BandOffsets[band + 1] = total;
+        });
+
+        // Scan
+        for (size_t band = 0; band < band_count; ++band) {
+            m_BandOffsets[band + 1] += m_BandOffsets[band];
+        }
+        m_Neighbours.resize(m_BandOffsets[band_count]);
+        m_Offsets[cells] = static_cast<uint32_t>(m_BandOffsets[band_count]);
+
+        // Fill
+        m_Pool.run(band_count, [&](const size_t band) {
+            const Index begin = std::min(rows, static_cast<Index>(band) * band_rows);
+            const Index end   = std::min(rows, begin + band_rows);
+            uint32_t    next  = static_cast<uint32_t>(m_BandOffsets[band]);
+            for (Index row = begin; row < end; ++row) {
+                for (Index col = 0; col < cols; ++col) {
+                    const uint32_t flat = static_cast<uint32_t>(row * cols + col);
+                    const uint32_t mask = neighbour_mask(maze, row, col);
+                    m_Offsets[flat] = next;
+
+                    if (mask & 1U) m_Neighbours[next++] = flat - cols;
+                    if (mask & 2U) m_Neighbours[next++] = flat - 1;
+                    if (mask & 4U) m_Neighbours[next++] = flat + 1;
+                    if (mask & 8U) m_Neighbours[next++] = flat + cols;
+                }
+            }
+        });
+    }
+
+} // maze
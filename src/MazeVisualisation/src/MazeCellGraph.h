@@ -0,0 +1,90 @@
+//
+// Header File: MazeCellGraph.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZECELLGRAPH_H
+#define MAZEVISUALISATION_MAZECELLGRAPH_H
+
+#include "MazeConstructs.h"
+#include "MazeParallel.h"
+
+namespace maze {
+
+    //############################################################################//
+    // | CELL GRAPH |
+    //############################################################################//
+
+    // Compressed sparse row adjacency over every cell of a maze so generic graph kernels can run
+    // on plain arrays: the neighbours of vertex 'v' (its flat index) are
+    // neighbours[offsets[v] .. offsets[v + 1]) in ascending order. Only passages both cells agree
+    // on are edges, so the graph is undirected & every edge is listed from both ends.
+    //
+    // Built over row bands in two parallel passes; the first stores each cell's degree & sums
+    // every band, the band totals are scanned on the calling thread and the second pass turns
+    // degrees into offsets while writing the neighbours. Buffers are kept between builds.
+    class CellGraph {
+
+    public:
+        inline static constexpr size_t s_MinBandRows = 64;
+
+    private:
+        ThreadPool&           m_Pool;
+        Index2D               m_Bounds;
+        std::vector<uint32_t> m_Offsets;
+        std::vector<uint32_t> m_Neighbours;
+        std::vector<size_t>   m_BandOffsets;
+
+    public:
+        explicit CellGraph(ThreadPool& pool = ThreadPool::get_shared());
+
+    public:
+        void build(const Maze2D& maze);
+
+        Index2D get_bounds() const {
+            return m_Bounds;
+        }
+
+        size_t get_vertex_count() const {
+            return m_Offsets.empty() ? 0 : m_Offsets.size() - 1;
+        }
+
+        // Undirected edges; each appears twice in the neighbour array
+        size_t get_edge_count() const {
+            return m_Neighbours.size() / 2;
+        }
+
+        uint32_t get_degree(const uint32_t vertex) const {
+            return m_Offsets[vertex + 1] - m_Offsets[vertex];
+        }
+
+        // Vertex count + 1 entries, the last is the neighbour count
+        const std::vector<uint32_t>& get_offsets() const {
+            return m_Offsets;
+        }
+
+        const std::vector<uint32_t>& get_neighbours() const {
+            return m_Neighbours;
+        }
+
+        template<class Function>
+        void for_each_neighbour(const uint32_t vertex, Function fn) const {
+            for (uint32_t i = m_Offsets[vertex]; i < m_Offsets[vertex + 1]; ++i) {
+                fn(m_Neighbours[i]);
+            }
+        }
+
+        size_t get_state_bytes() const {
+            return (m_Offsets.capacity() + m_Neighbours.capacity()) * sizeof(uint32_t);
+        }
+
+    private:
+        // Open sides of a cell as a mask in ascending neighbour order (N, W, E, S)
+        static uint32_t neighbour_mask(const Maze2D& maze, Index row, Index col);
+    };
+
+} // maze
+
+#endif
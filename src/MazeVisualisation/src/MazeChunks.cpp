@@ -0,0 +1,216 @@
+//
+// Header File: MazeChunks.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeChunks.h"
+
+namespace maze {
+
+    ChunkedMaze::ChunkedMaze(
+            uint64_t world_seed,
+            size_t budget
+    ) : m_WorldSeed(world_seed),
+        m_Cache(budget),
+        m_Worker(),
+        m_Mutex(),
+        m_Signal(),
+        m_Pending(),
+        m_Ready(),
+        m_Requested(),
+        m_IsRunning(true) {
+        m_Worker = std::thread([this]() { worker_loop(); });
+        HINFO("[CHUNKED_MAZE]", " # World Seed: '{}'", m_WorldSeed);
+    }
+
+    ChunkedMaze::~ChunkedMaze() {
+        {
+            std::lock_guard lock{ m_Mutex };
+            m_IsRunning = false;
+        }
+        m_Signal.notify_all();
+        if (m_Worker.joinable()) m_Worker.join();
+    }
+
+    //############################################################################//
+    // | CACHE ACCESS |
+    //############################################################################//
+
+    void ChunkedMaze::poll() {
+        std::vector<std::pair<Index2D, ChunkPtr>> ready{};
+        {
+            std::lock_guard lock{ m_Mutex };
+            ready.swap(m_Ready);
+            for (const auto& [chunk, _] : ready) m_Requested.erase(chunk);
+        }
+
+        for (auto& [chunk, ptr] : ready) {
+            m_Cache.put(chunk, std::move(ptr), chunk_cost());
+        }
+    }
+
+    ChunkedMaze::ChunkPtr ChunkedMaze::find_chunk(Index2D chunk) {
+        ChunkPtr* ptr = m_Cache.find(chunk);
+        if (ptr != nullptr) return *ptr;
+
+        request_chunk(chunk);
+        return nullptr;
+    }
+
+    std::optional<Cell> ChunkedMaze::find_cell(Index2D global) {
+        ChunkPtr chunk = find_chunk(chunk_of(global));
+        if (chunk == nullptr) return std::nullopt;
+        return chunk->get_cell(local_of(global));
+    }
+
+    size_t ChunkedMaze::copy_region(Index2D origin, Maze2D& out) {
+        const Index2D last        = origin + out.get_bounds() - Index2D{ 1, 1 };
+        const Index2D first_chunk = chunk_of(origin);
+        const Index2D last_chunk  = chunk_of(last);
+        size_t        missing     = 0;
+
+        for (Index cr = first_chunk.row; cr <= last_chunk.row; ++cr) {
+            for (Index cc = first_chunk.col; cc <= last_chunk.col; ++cc) {
+                ChunkPtr chunk = find_chunk(Index2D{ cr, cc });
+                if (chunk == nullptr) ++missing;
+
+                // Overlap of this chunk with the output region (Global Coordinates)
+                const Index row_begin = std::max(origin.row, cr * s_ChunkSize);
+                const Index row_end   = std::min(last.row, cr * s_ChunkSize + s_ChunkSize - 1);
+                const Index col_begin = std::max(origin.col, cc * s_ChunkSize);
+                const Index col_end   = std::min(last.col, cc * s_ChunkSize + s_ChunkSize - 1);
+
+                for (Index row = row_begin; row <= row_end; ++row) {
+                    for (Index col = col_begin; col <= col_end; ++col) {
+                        const Index2D global{ row, col };
+                        out.get_cell(global - origin) = chunk == nullptr
+                                                        ? cellof<Flag::EMPTY_PATH>()
+                                                        : chunk->get_cell(local_of(global));
+                    }
+                }
+            }
+        }
+
+        out.notify_reset();
+        return missing;
+    }
+
+    //############################################################################//
+    // | BACKGROUND WORKER |
+    //############################################################################//
+
+    void ChunkedMaze::request_chunk(Index2D chunk) {
+        {
+            std::lock_guard lock{ m_Mutex };
+            if (m_Requested.contains(chunk)) return;
+            m_Requested.insert(chunk);
+            m_Pending.push_back(chunk);
+        }
+        m_Signal.notify_one();
+    }
+
+    void ChunkedMaze::worker_loop() {
+        while (true) {
+            Index2D chunk{};
+            {
+                std::unique_lock lock{ m_Mutex };
+                m_Signal.wait(lock, [this]() { return !m_IsRunning || !m_Pending.empty(); });
+                if (!m_IsRunning) return;
+
+                chunk = m_Pending.front();
+                m_Pending.pop_front();
+            }
+
+            ChunkPtr ptr = std::make_shared<const Maze2D>(generate_chunk(m_WorldSeed, chunk));
+
+            std::lock_guard lock{ m_Mutex };
+            m_Ready.emplace_back(chunk, std::move(ptr));
+        }
+    }
+
+    //############################################################################//
+    // | DETERMINISTIC GENERATION |
+    //############################################################################//
+
+    Maze2D ChunkedMaze::generate_chunk(uint64_t world_seed, Index2D chunk) {
+        Maze2D          maze{ s_ChunkSize, s_ChunkSize };
+        std::mt19937_64 rng{ splitmix64(world_seed ^ splitmix64(pack_index(chunk))) };
+
+        // mt19937_64's output is fixed by the standard but distributions are not, so indices are
+        // taken from the raw output to keep chunks identical across standard libraries
+        const auto pick = [&rng](const Index count) {
+            return static_cast<Index>(rng() % static_cast<uint64_t>(count));
+        };
+
+        // Iterative Recursive Backtracker; produces a perfect maze within the chunk
+        std::vector<Index2D> stack{};
+        stack.reserve(maze.get_size());
+        const Index start_row = pick(s_ChunkSize);
+        stack.push_back(Index2D{ start_row, pick(s_ChunkSize) });
+        maze.set_flags(stack.back(), { Flag::VISITED });
+
+        std::array<Cardinal, s_CardinalCount> options{};
+        while (!stack.empty()) {
+            const Index2D pos   = stack.back();
+            int           count = 0;
+
+            for (const Cardinal dir : s_AllCardinals) {
+                if (maze.inbounds(pos, dir)
+                    && is_unset<Flag::VISITED>(maze.get_cell(pos + cardinal_offset(dir)))) {
+                    options[count++] = dir;
+                }
+            }
+
+            if (count == 0) {
+                stack.pop_back();
+                continue;
+            }
+
+            const Cardinal dir  = options[pick(count)];
+            const Index2D  next = pos + cardinal_offset(dir);
+            maze.make_path(pos, dir);
+            maze.set_flags(next, { Flag::VISITED });
+            stack.push_back(next);
+        }
+
+        // Agreed Border Openings
+        constexpr Index last  = s_ChunkSize - 1;
+        const Index     north = border_opening(world_seed, chunk, Cardinal::NORTH);
+        const Index     east  = border_opening(world_seed, chunk, Cardinal::EAST);
+        const Index     south = border_opening(world_seed, chunk, Cardinal::SOUTH);
+        const Index     west  = border_opening(world_seed, chunk, Cardinal::WEST);
+        maze.set_flags(Index2D{ 0, north }, { Flag::PATH_NORTH });
+        maze.set_flags(Index2D{ east, last }, { Flag::PATH_EAST });
+        maze.set_flags(Index2D{ last, south }, { Flag::PATH_SOUTH });
+        maze.set_flags(Index2D{ west, 0 }, { Flag::PATH_WEST });
+
+        maze.set_flags_all<Flag::RED, Flag::GREEN, Flag::BLUE, Flag::FINISHED>();
+        return maze;
+    }
+
+    Index ChunkedMaze::border_opening(uint64_t world_seed, Index2D chunk, Cardinal dir) {
+
+        // Each border is keyed by the chunk to its North/West so both sides agree
+        uint64_t axis = 0;
+        switch (dir) {
+            case Cardinal::NORTH:
+                chunk = chunk + Index2D{ -1, 0 };
+                axis  = 1;
+                break;
+            case Cardinal::SOUTH:
+                axis = 1;
+                break;
+            case Cardinal::WEST:
+                chunk = chunk + Index2D{ 0, -1 };
+                break;
+            case Cardinal::EAST:
+                break;
+        }
+
+        const uint64_t key = splitmix64(world_seed + splitmix64(pack_index(chunk) * 2 + axis));
+        return static_cast<Index>(key % static_cast<uint64_t>(s_ChunkSize));
+    }
+
+} // maze
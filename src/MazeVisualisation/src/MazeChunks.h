@@ -0,0 +1,114 @@
+//
+// Header File: MazeChunks.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZECHUNKS_H
+#define MAZEVISUALISATION_MAZECHUNKS_H
+
+#include "MazeConstructs.h"
+#include "LruCache.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace maze {
+
+    //############################################################################//
+    // | CHUNKED (UNBOUNDED) MAZE |
+    //############################################################################//
+
+    // An unbounded maze made of fixed size chunks. Every chunk is a perfect maze generated from a
+    // seed derived from its coordinates, and each shared border has exactly one opening agreed on
+    // by both sides, so any chunk can be (re)generated independently and always stitches up with
+    // its neighbours. Chunks are generated by a background worker and kept in an LRU cache.
+    class ChunkedMaze {
+
+    public:
+        using ChunkPtr = std::shared_ptr<const Maze2D>;
+        using ChunkCache = LruCache<Index2D, ChunkPtr, Index2D::Hasher>;
+
+    public:
+        inline static constexpr Index  s_ChunkSize     = 16;
+        inline static constexpr size_t s_DefaultBudget = 4 * 1024 * 1024;
+
+    private:
+        uint64_t   m_WorldSeed;
+        ChunkCache m_Cache;
+
+        // Background Worker
+        std::thread                                  m_Worker;
+        std::mutex                                   m_Mutex;
+        std::condition_variable                      m_Signal;
+        std::deque<Index2D>                          m_Pending;
+        std::vector<std::pair<Index2D, ChunkPtr>>    m_Ready;
+        std::unordered_set<Index2D, Index2D::Hasher> m_Requested;
+        bool                                         m_IsRunning;
+
+    public:
+        explicit ChunkedMaze(uint64_t world_seed, size_t budget = s_DefaultBudget);
+        ~ChunkedMaze();
+
+        ChunkedMaze(const ChunkedMaze&) = delete;
+        ChunkedMaze& operator =(const ChunkedMaze&) = delete;
+
+    public:
+        // Moves finished chunks from the worker into the cache; call once per frame
+        void poll();
+
+        // Returns the chunk if resident; otherwise queues it for generation and returns nullptr
+        ChunkPtr find_chunk(Index2D chunk);
+
+        // Cell at the global position, empty if its chunk isn't resident yet
+        std::optional<Cell> find_cell(Index2D global);
+
+        // Copies the cells starting at the global origin into the provided maze, returns the
+        // number of chunks which were not yet resident (their cells are left as EMPTY_PATH)
+        size_t copy_region(Index2D origin, Maze2D& out);
+
+        uint64_t get_world_seed() const {
+            return m_WorldSeed;
+        }
+
+        const ChunkCache& get_cache() const {
+            return m_Cache;
+        }
+
+        void set_budget(size_t budget) {
+            m_Cache.set_budget(budget);
+        }
+
+    public:
+        static Maze2D generate_chunk(uint64_t world_seed, Index2D chunk);
+        static Index border_opening(uint64_t world_seed, Index2D chunk, Cardinal dir);
+
+        static constexpr Index floor_div(const Index value, const Index divisor) {
+            return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+        }
+
+        static constexpr Index2D chunk_of(const Index2D global) {
+            return Index2D{ floor_div(global.row, s_ChunkSize), floor_div(global.col, s_ChunkSize) };
+        }
+
+        static constexpr Index2D local_of(const Index2D global) {
+            const Index2D chunk = chunk_of(global);
+            return Index2D{ global.row - chunk.row * s_ChunkSize, global.col - chunk.col * s_ChunkSize };
+        }
+
+        static constexpr size_t chunk_cost() {
+            return sizeof(Maze2D) + sizeof(Cell) * s_ChunkSize * s_ChunkSize;
+        }
+
+    private:
+        void request_chunk(Index2D chunk);
+        void worker_loop();
+    };
+
+} // maze
+
+#endif
@@ -0,0 +1,227 @@
+//
+// Header File: MazeComponents.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeComponents.h"
+
+namespace maze {
+
+    ComponentLabeller::ComponentLabeller(
+            ThreadPool& pool
+    ) : m_Pool(pool),
+        m_Bounds{ 0, 0 },
+        m_Labels(),
+        m_ComponentCount(0),
+        m_PassageCount(0),
+        m_InconsistentCount(0),
+        m_BorderOpeningCount(0) {
+    }
+
+    //############################################################################//
+    // | UNION FIND |
+    //############################################################################//
+
+    // Path halving; parents only ever point at lower indices
+    uint32_t ComponentLabeller::find(uint32_t cell) {
+        while (m_Labels[cell] != cell) {
+            m_Labels[cell] = m_Labels[m_Labels[cell]];
+            cell = m_Labels[cell];
+        }
+        return cell;
+    }
+
+    void ComponentLabeller::unite(
+            const uint32_t a,
+            const uint32_t b,
+            std::vector<uint32_t>* merged
+    ) {
+        uint32_t root_a = find(a);
+        uint32_t root_b = find(b);
+        if (root_a == root_b) return;
+        if (root_a > root_b) std::swap(root_a, root_b);
+
+        m_Labels[root_b] = root_a;
+        if (merged != nullptr) merged->push_back(root_b);
+    }
+
+    //############################################################################//
+    // | LABELLING |
+    //############################################################################//
+
+    void ComponentLabeller::label(const Maze2D& maze) {
+        m_Bounds = maze.get_bounds();
+        m_Labels.resize(maze.get_size());
+
+        // Bands are fixed up front so the border rows are known for the merge
+        const Index  rows       = m_Bounds.row;
+        const Index  cols       = m_Bounds.col;
+        const size_t band_count = std::clamp<size_t>(
+                static_cast<size_t>(rows) / s_MinBandRows,
+                1,
+                m_Pool.get_thread_count() * 4
+        );
+        const Index  band_rows  = static_cast<Index>((rows + band_count - 1) / band_count);
+
+        std::vector<BandCounts> counts(band_count, BandCounts{});
+        m_Pool.run(band_count, [&](const size_t band) {
+            const Index begin = static_cast<Index>(band) * band_rows;
+            const Index end   = std::min(rows, begin + band_rows);
+            if (begin < end) counts[band] = label_band(maze, begin, end);
+        });
+
+        m_PassageCount       = 0;
+        m_InconsistentCount  = 0;
+        m_BorderOpeningCount = 0;
+        for (const BandCounts& band : counts) {
+            m_PassageCount += band.passages;
+            m_InconsistentCount += band.inconsistent;
+            m_BorderOpeningCount += band.border_openings;
+        }
+
+        // Passages across band borders; every band's cells point directly at a band root so
+        // only the roots which get linked here can be more than one step from their label
+        std::vector<uint32_t> merged{};
+        const Cell*           data = maze.get_cell_data();
+        for (Index row = band_rows; row < rows; row += band_rows) {
+            for (Index col = 0; col < cols; ++col) {
+                const uint32_t flat = static_cast<uint32_t>(row * cols + col);
+                if (is_set<Flag::PATH_NORTH>(data[flat])
+                    && is_set<Flag::PATH_SOUTH>(data[flat - cols])) {
+                    unite(flat - cols, flat, &merged);
+                }
+            }
+        }
+        for (const uint32_t root : merged) m_Labels[root] = find(root);
+
+        // Every cell now points at a root or a merged root which points at its final label;
+        // only cells whose label changes are written, none of which are read by other bands
+        std::atomic<size_t> components{ 0 };
+        m_Pool.parallel_for(m_Labels.size(), [&](const size_t begin, const size_t end) {
+            size_t roots = 0;
+            for (size_t i = begin; i < end; ++i) {
+                const uint32_t parent = m_Labels[i];
+                const uint32_t label  = m_Labels[parent];
+                if (label != parent) m_Labels[i] = label;
+                if (label == i) ++roots;
+            }
+            components.fetch_add(roots, std::memory_order_relaxed);
+        }, 1 << 16);
+        m_ComponentCount = components.load();
+
+        HINFO("[COMPONENTS]", " # Cells: {}, Components: {}, Passages: {}, Bands: {}",
+              m_Labels.size(), m_ComponentCount, m_PassageCount, band_count
+        );
+    }
+
+    ComponentLabeller::BandCounts ComponentLabeller::label_band(
+            const Maze2D& maze,
+            const Index row_begin,
+            const Index row_end
+    ) {
+        const Cell* data = maze.get_cell_data();
+        const Index rows = m_Bounds.row;
+        const Index cols = m_Bounds.col;
+        BandCounts  counts{};
+
+        // Path flag bit positions; 'side(bit, cell)' is 1 if the cell is open on that side
+        constexpr int north = 1, east = 2, south = 3, west = 4;
+        const auto    side  = [](const int bit, const Cell cell) { return (cell >> bit) & 1U; };
+
+        for (Index row = row_begin; row < row_end; ++row) {
+            const uint32_t first = static_cast<uint32_t>(row * cols);
+            const Cell*    line  = data + first;
+            const Cell*    above = row > 0 ? line - cols : nullptr;
+
+            counts.border_openings += side(west, line[0]) + side(east, line[cols - 1]);
+            for (Index col = 0; col < cols && row == 0; ++col) {
+                counts.border_openings += side(north, line[col]);
+            }
+            for (Index col = 0; col < cols && row == rows - 1; ++col) {
+                counts.border_openings += side(south, line[col]);
+            }
+
+            // Passages are checked from the cell to their east or south, agreement &
+            // disagreement are plain bit ops. Linking to the west neighbour's parent needs no
+            // find (it already precedes this cell) so only north passages use the union-find.
+            for (Index col = 0; col < cols; ++col) {
+                const uint32_t flat = first + static_cast<uint32_t>(col);
+                const Cell     cell = line[col];
+
+                if (col > 0) {
+                    const Cell open = side(west, cell) & side(east, line[col - 1]);
+                    counts.passages += open;
+                    counts.inconsistent += side(west, cell) ^ side(east, line[col - 1]);
+                    m_Labels[flat] = open != 0 ? m_Labels[flat - 1] : flat;
+                } else {
+                    m_Labels[flat] = flat;
+                }
+
+                if (above == nullptr) continue;
+                const Cell open = side(north, cell) & side(south, above[col]);
+                counts.passages += open;
+                counts.inconsistent += side(north, cell) ^ side(south, above[col]);
+                if (open != 0 && row > row_begin) unite(flat - cols, flat);
+            }
+        }
+
+        // Parents precede their children so one forward pass points every cell at its root
+        const uint32_t begin = static_cast<uint32_t>(row_begin * cols);
+        const uint32_t end   = static_cast<uint32_t>(row_end * cols);
+        for (uint32_t i = begin; i < end; ++i) m_Labels[i] = m_Labels[m_Labels[i]];
+
+        return counts;
+    }
+
+    size_t ComponentLabeller::get_component_size(const Index flat) const {
+        const uint32_t      label = m_Labels[flat];
+        std::atomic<size_t> count{ 0 };
+        m_Pool.parallel_for(m_Labels.size(), [&](const size_t begin, const size_t end) {
+            size_t local = 0;
+            for (size_t i = begin; i < end; ++i) local += m_Labels[i] == label;
+            count.fetch_add(local, std::memory_order_relaxed);
+        }, 1 << 16);
+        return count.load();
+    }
+
+    //############################################################################//
+    // | MAZE VALIDATION |
+    //############################################################################//
+
+    std::string MazeValidation::to_string() const {
+        return std::format(
+                "Cells: {}, Components: {}, Cycles: {}, Unreachable: {}, Inconsistent: {}, "
+                "Border Openings: {}, Perfect: {}",
+                cell_count, component_count, cycle_count, unreachable_count, inconsistent_count,
+                border_opening_count, is_perfect()
+        );
+    }
+
+    MazeValidation validate_maze(const Maze2D& maze, const Index2D root, ThreadPool& pool) {
+        ComponentLabeller labeller{ pool };
+        return validate_maze(maze, labeller, root);
+    }
+
+    MazeValidation validate_maze(
+            const Maze2D& maze,
+            ComponentLabeller& labeller,
+            const Index2D root
+    ) {
+        maze.check_index(root);
+        labeller.label(maze);
+
+        // A spanning forest has V - C edges; every passage beyond that closes a loop
+        const size_t cells = maze.get_size();
+        return MazeValidation{
+                cells,
+                labeller.get_component_count(),
+                labeller.get_passage_count() + labeller.get_component_count() - cells,
+                cells - labeller.get_component_size(root.flat(maze.get_col_count())),
+                labeller.get_inconsistent_count(),
+                labeller.get_border_opening_count()
+        };
+    }
+
+} // maze
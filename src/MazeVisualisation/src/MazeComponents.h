@@ -0,0 +1,133 @@
+//
+// Header File: MazeComponents.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZECOMPONENTS_H
+#define MAZEVISUALISATION_MAZECOMPONENTS_H
+
+#include "MazeConstructs.h"
+#include "MazeParallel.h"
+
+namespace maze {
+
+    //############################################################################//
+    // | CONNECTED COMPONENT LABELLING |
+    //############################################################################//
+
+    // Labels every cell with the representative (lowest flat index) of its connected component.
+    // A passage counts when both cells agree it is open; one sided openings are reported as
+    // inconsistent walls instead of being followed.
+    //
+    // Row bands are labelled on separate threads with a union-find that always links the larger
+    // root under the smaller, so every parent precedes its child and a single forward pass
+    // flattens a band. The passages across band borders are then merged on the calling thread
+    // (a few rows in total) and only the band roots that merged need resolving before a final
+    // parallel pass points every cell at its component's representative.
+    class ComponentLabeller {
+
+    public:
+        inline static constexpr size_t s_MinBandRows = 64;
+
+    private:
+        struct BandCounts {
+            size_t passages;
+            size_t inconsistent;
+            size_t border_openings;
+        };
+
+    private:
+        ThreadPool&           m_Pool;
+        Index2D               m_Bounds;
+        std::vector<uint32_t> m_Labels;
+        size_t                m_ComponentCount;
+        size_t                m_PassageCount;
+        size_t                m_InconsistentCount;
+        size_t                m_BorderOpeningCount;
+
+    public:
+        explicit ComponentLabeller(ThreadPool& pool = ThreadPool::get_shared());
+
+    public:
+        void label(const Maze2D& maze);
+
+        // Representative cell of the component holding 'flat'
+        uint32_t get_label(const Index flat) const {
+            return m_Labels[flat];
+        }
+
+        const std::vector<uint32_t>& get_labels() const {
+            return m_Labels;
+        }
+
+        size_t get_component_count() const {
+            return m_ComponentCount;
+        }
+
+        // Cells in the same component as 'flat' (counted in parallel)
+        size_t get_component_size(Index flat) const;
+
+        // Open passages between two in bounds cells (both sides agree)
+        size_t get_passage_count() const {
+            return m_PassageCount;
+        }
+
+        // Passages open on one side only
+        size_t get_inconsistent_count() const {
+            return m_InconsistentCount;
+        }
+
+        // Openings leading out of the maze (chunk borders & entrances)
+        size_t get_border_opening_count() const {
+            return m_BorderOpeningCount;
+        }
+
+        size_t get_state_bytes() const {
+            return m_Labels.capacity() * sizeof(uint32_t);
+        }
+
+    private:
+        uint32_t find(uint32_t cell);
+        void unite(uint32_t a, uint32_t b, std::vector<uint32_t>* merged = nullptr);
+
+        BandCounts label_band(const Maze2D& maze, Index row_begin, Index row_end);
+    };
+
+    //############################################################################//
+    // | MAZE VALIDATION |
+    //############################################################################//
+
+    // A maze is perfect when it is one component without loops; cycles = E - V + C
+    struct MazeValidation {
+        size_t cell_count;
+        size_t component_count;
+        size_t cycle_count;
+        size_t unreachable_count;
+        size_t inconsistent_count;
+        size_t border_opening_count;
+
+        bool is_perfect() const {
+            return component_count == 1 && cycle_count == 0 && inconsistent_count == 0;
+        }
+
+        std::string to_string() const;
+    };
+
+    // Unreachable cells are those outside the component of 'root'
+    MazeValidation validate_maze(
+            const Maze2D& maze,
+            Index2D root = Index2D{ 0, 0 },
+            ThreadPool& pool = ThreadPool::get_shared()
+    );
+
+    MazeValidation validate_maze(
+            const Maze2D& maze,
+            ComponentLabeller& labeller,
+            Index2D root = Index2D{ 0, 0 }
+    );
+
+} // maze
+
+#endif
@@ -12,8 +12,10 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include <algorithm>
+#include <bit>
 #include <vector>
 #include <cstdint>
+#include <numeric>
 #include <random>
 #include <stack>
 #include <unordered_set>
@@ -29,12 +31,8 @@ namespace maze {
     using Index = int;
     using Distribution = std::uniform_int_distribution<Index>;
 
-    // Determinisitc / Reproducable Random Numbers
-    #ifdef DETERMINISTIC
-    using Random = std::mt19937;
-    #else
-    using Random = std::random_device;
-    #endif
+    // Seeded from a random device unless DETERMINISTIC is defined; generators can reseed theirs
+    using Random = std::mt19937_64;
 
 
     struct Index2D {
@@ -48,8 +46,9 @@ namespace maze {
             return row * bounds.col + col;
         }
 
+        // Widened first; a 100k x 100k grid does not fit an Index
         constexpr size_t size() const {
-            return row * col;
+            return static_cast<size_t>(row) * static_cast<size_t>(col);
         }
 
         constexpr bool operator >(const Index2D i) const { return i.row < row && i.col < col; }
@@ -128,6 +127,23 @@ namespace maze {
         };
     };
 
+    //############################################################################//
+    // | HASHING |
+    //############################################################################//
+
+    // SplitMix64 finaliser; cheap, stateless, and well distributed for sequential inputs
+    static constexpr uint64_t splitmix64(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    static constexpr uint64_t pack_index(const Index2D pos) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(pos.row)) << 32)
+               | static_cast<uint64_t>(static_cast<uint32_t>(pos.col));
+    }
+
     //############################################################################//
     // | MAZE FLAGS |
     //############################################################################//
@@ -257,6 +273,10 @@ namespace maze {
         return -cardinal_offset(dir);
     }
 
+    static constexpr Cardinal opposite(const Cardinal dir) {
+        return static_cast<Cardinal>((static_cast<char>(dir) + 2) % s_CardinalCount);
+    }
+
     static std::string cardinal_to_string(const Cardinal dir) {
         switch (dir) {
             case Cardinal::NORTH:
@@ -513,18 +533,55 @@ namespace maze {
     // | MAZE DATA STRUCTURE |
     //############################################################################//
 
+    class Maze2D;
+
+    template<bool IsConst>
+    class BasicMazeView;
+
+    // Notified synchronously (on the mutating thread) of structural changes to a Maze2D. Only
+    // 'make_path' opening a closed wall & wholesale rewrites (reset, resize, assignment) are
+    // reported; flag changes through set/unset_flags are not.
+    class WallListener {
+
+    public:
+        virtual ~WallListener() = default;
+
+    public:
+        // The wall between 'pos' and 'pos + dir' was opened
+        virtual void on_path_made(const Maze2D& maze, Index2D pos, Cardinal dir) = 0;
+
+        // Any cell may have changed, bounds included
+        virtual void on_maze_reset(const Maze2D& maze) = 0;
+    };
+
     class Maze2D {
 
+        // Views write cells & the wall hash directly
+        template<bool IsConst>
+        friend class BasicMazeView;
+
         //############################################################################//
         // | ALIAS & MEMBERS |
         //############################################################################//
 
     public:
         using CellVec = std::vector<Cell>;
+        using CostVec = std::vector<uint8_t>;
+
+        inline static constexpr uint8_t s_DefaultCost = 1;
 
     private:
-        Index2D m_GridSize;
-        CellVec m_Cells;
+        inline static constexpr uint64_t s_WallSalt = 0x57A11C0DE5EED001ULL;
+        inline static constexpr uint64_t s_CostSalt = 0xC0570F7E44A1B002ULL;
+        inline static constexpr Cell     s_PathMask = 0xFU << 1;
+
+    private:
+        Index2D                    m_GridSize;
+        CellVec                    m_Cells;
+        CostVec                    m_Costs;
+        uint64_t                   m_WallHash;
+        uint64_t                   m_CostHash;
+        std::vector<WallListener*> m_Listeners;
 
         //############################################################################//
         // | CONSTRUCTORS |
@@ -536,37 +593,136 @@ namespace maze {
                 Index rows,
                 Index cols
         ) : m_GridSize(Index2D{ rows, cols }),
-            m_Cells(CellVec(static_cast<unsigned int>(m_GridSize.size()),
-                            cellof<Flag::EMPTY_PATH>())) {
+            m_Cells(CellVec(m_GridSize.size(),
+                            cellof<Flag::EMPTY_PATH>())),
+            m_Costs(),
+            m_WallHash(0),
+            m_CostHash(0),
+            m_Listeners() {
 
             if (m_GridSize.size() <= 0) {
                 HERR("[MAZE2D]", " # Invalid size '{}'...", m_GridSize.size());
                 throw std::exception();
             }
+            m_WallHash = base_hash();
         }
 
         Maze2D(
                 const Maze2D& maze
         ) : m_GridSize(maze.m_GridSize),
-            m_Cells(maze.m_Cells) {
+            m_Cells(maze.m_Cells),
+            m_Costs(maze.m_Costs),
+            m_WallHash(maze.m_WallHash),
+            m_CostHash(maze.m_CostHash),
+            m_Listeners() {
             HINFO("[MAZE2D_CPY]", " # Copy: '{}'", maze.to_string());
         }
 
         Maze2D(
                 Maze2D&& maze
         ) : m_GridSize(maze.m_GridSize),
-            m_Cells(std::move(maze.m_Cells)) {
+            m_Cells(std::move(maze.m_Cells)),
+            m_Costs(std::move(maze.m_Costs)),
+            m_WallHash(maze.m_WallHash),
+            m_CostHash(maze.m_CostHash),
+            m_Listeners() {
             HINFO("[MAZE2D_MOVE]", " # Move: '{}'", maze.to_string());
         }
 
     public:
 
+        // Listeners stay with this object (they are not taken from 'o') and see a reset
         Maze2D& operator =(Maze2D&& o) {
             m_GridSize = o.m_GridSize;
             m_Cells    = std::move(o.m_Cells);
+            m_Costs    = std::move(o.m_Costs);
+            m_WallHash = o.m_WallHash;
+            m_CostHash = o.m_CostHash;
+            notify_listeners();
             return *this;
         }
 
+        //############################################################################//
+        // | LISTENERS |
+        //############################################################################//
+
+    public:
+
+        // Listeners are not owned and belong to this object, copies & moves start with none
+        void add_listener(WallListener* listener) {
+            if (std::find(m_Listeners.begin(), m_Listeners.end(), listener) == m_Listeners.end()) {
+                m_Listeners.push_back(listener);
+            }
+        }
+
+        void remove_listener(WallListener* listener) {
+            std::erase(m_Listeners, listener);
+        }
+
+        // For code which writes cells in bulk through 'get_cell'; re-hashes then tells listeners
+        void notify_reset() {
+            rehash();
+            notify_listeners();
+        }
+
+    private:
+        void notify_listeners() const {
+            for (WallListener* listener : m_Listeners) listener->on_maze_reset(*this);
+        }
+
+        //############################################################################//
+        // | ZOBRIST HASH |
+        //############################################################################//
+
+        // 64 bit hash of the walls & cell costs kept up to date as they change. Each open side of
+        // a cell (path bit) and each non default cost has its own key and the hash is the XOR of
+        // the keys present, so a change costs O(1) and 'reset' restores the hash of an empty maze
+        // of the same size. Colour flags are not hashed. Writes made directly through 'get_cell'
+        // are only seen once 'notify_reset' (or 'rehash') is called.
+
+    public:
+
+        uint64_t get_hash() const {
+            return m_WallHash ^ m_CostHash;
+        }
+
+        // Recomputes the hash from every cell
+        void rehash() {
+            m_WallHash = base_hash();
+            m_CostHash = 0;
+            for (size_t flat = 0; flat < m_Cells.size(); ++flat) {
+                update_hash(flat, 0, m_Cells[flat]);
+                if (!m_Costs.empty() && m_Costs[flat] != s_DefaultCost) {
+                    m_CostHash ^= cost_key(flat, m_Costs[flat]);
+                }
+            }
+        }
+
+    private:
+        uint64_t base_hash() const {
+            return splitmix64(s_WallSalt ^ pack_index(m_GridSize));
+        }
+
+        static uint64_t cost_key(const size_t flat, const uint8_t cost) {
+            return splitmix64(s_CostSalt ^ ((static_cast<uint64_t>(flat) << 8) | cost));
+        }
+
+        // XOR of the keys of every path bit which differs; at most four, usually one
+        static uint64_t path_keys(const size_t flat, const Cell before, const Cell after) {
+            uint32_t changed = ((before ^ after) & s_PathMask) >> 1;
+            uint64_t keys    = 0;
+            while (changed != 0) {
+                const uint64_t side = std::countr_zero(changed);
+                keys ^= splitmix64((static_cast<uint64_t>(flat) << 2) | side);
+                changed &= changed - 1;
+            }
+            return keys;
+        }
+
+        void update_hash(const size_t flat, const Cell before, const Cell after) {
+            m_WallHash ^= path_keys(flat, before, after);
+        }
+
         //############################################################################//
         // | GETTERS |
         //############################################################################//
@@ -670,6 +826,61 @@ namespace maze {
             });
         }
 
+        //############################################################################//
+        // | COST PLANE |
+        //############################################################################//
+
+        // Optional cost of entering each cell (terrain); absent until enabled or first set, in
+        // which case every cell costs s_DefaultCost. Costs are not walls, so changing them is not
+        // reported to listeners and reset() leaves them as they are.
+
+    public:
+
+        bool has_costs() const {
+            return !m_Costs.empty();
+        }
+
+        void enable_costs(const uint8_t fill = s_DefaultCost) {
+            check_cost(fill);
+            m_Costs.assign(get_size(), fill);
+            rehash();
+        }
+
+        void disable_costs() {
+            m_Costs.clear();
+            m_Costs.shrink_to_fit();
+            m_CostHash = 0;
+        }
+
+        uint8_t get_cost(const Index2D pos) const {
+            check_index(pos);
+            return m_Costs.empty() ? s_DefaultCost : m_Costs[pos.flat(m_GridSize)];
+        }
+
+        void set_cost(const Index2D pos, const uint8_t cost) {
+            check_index(pos);
+            check_cost(cost);
+            if (m_Costs.empty()) m_Costs.assign(get_size(), s_DefaultCost);
+
+            const size_t flat = pos.flat(m_GridSize);
+            if (m_Costs[flat] != s_DefaultCost) m_CostHash ^= cost_key(flat, m_Costs[flat]);
+            if (cost != s_DefaultCost) m_CostHash ^= cost_key(flat, cost);
+            m_Costs[flat] = cost;
+        }
+
+        // Flat cost plane; nullptr if costs are not enabled
+        const uint8_t* get_cost_data() const {
+            return m_Costs.empty() ? nullptr : m_Costs.data();
+        }
+
+    private:
+        static void check_cost(const uint8_t cost) {
+            if (cost == 0) {
+                HERR("[MAZE2D]", " # Cell costs must be at least 1...");
+                throw std::exception();
+            }
+        }
+
         //############################################################################//
         // | CELL METHODS |
         //############################################################################//
@@ -695,8 +906,10 @@ namespace maze {
         }
 
         void set_flags(const Index2D pos, std::initializer_list<Flag> flags) {
-            Cell& cell = get_cell(pos);
+            Cell&      cell   = get_cell(pos);
+            const Cell before = cell;
             for (const Flag flag : flags) cell |= cellof(flag);
+            update_hash(pos.flat(m_GridSize), before, cell);
         }
 
         template<Flag... Flags>
@@ -705,11 +918,23 @@ namespace maze {
             std::for_each(m_Cells.begin(), m_Cells.end(), [=](Cell& cell) {
                 cell |= merged;
             });
+            if constexpr ((merged & s_PathMask) != 0) rehash();
+        }
+
+        template<Flag... Flags>
+        void unset_flags_all() {
+            constexpr Cell merged = (... | cellof<Flags>());
+            std::for_each(m_Cells.begin(), m_Cells.end(), [=](Cell& cell) {
+                cell &= ~merged;
+            });
+            if constexpr ((merged & s_PathMask) != 0) rehash();
         }
 
         void unset_flags(const Index2D pos, std::initializer_list<Flag> flags) {
-            Cell& cell = get_cell(pos);
+            Cell&      cell   = get_cell(pos);
+            const Cell before = cell;
             for (const Flag flag : flags) cell &= ~cellof(flag);
+            update_hash(pos.flat(m_GridSize), before, cell);
         }
 
         bool check_flags(const Index2D pos, std::initializer_list<Flag> flags) const {
@@ -720,6 +945,10 @@ namespace maze {
             Cell& from = get_cell(pos);
             Cell& to   = get_cell(pos + cardinal_offset(dir));
 
+            const bool was_wall    = is_wall(dir, from);
+            const Cell from_before = from;
+            const Cell to_before   = to;
+
             // Unset Empty Path Flag
             from &= ~cellof<Flag::EMPTY_PATH>();
             to &= ~cellof<Flag::EMPTY_PATH>();
@@ -748,6 +977,13 @@ namespace maze {
                 default:
                     throw std::exception();
             }
+
+            update_hash(pos.flat(m_GridSize), from_before, from);
+            update_hash((pos + cardinal_offset(dir)).flat(m_GridSize), to_before, to);
+
+            if (was_wall) {
+                for (WallListener* listener : m_Listeners) listener->on_path_made(*this, pos, dir);
+            }
         }
 
         void make_path(Index2D a, Index2D b) {
@@ -864,6 +1100,8 @@ namespace maze {
             std::for_each(m_Cells.begin(), m_Cells.end(), [&](auto& item) {
                 item = cellof<Flag::EMPTY_PATH>();
             });
+            m_WallHash = base_hash();
+            notify_listeners();
         }
 
         void resize(Index2D new_size) {
@@ -873,6 +1111,8 @@ namespace maze {
             }
             m_GridSize = new_size;
             m_Cells.resize(new_size.size(), cellof<Flag::EMPTY_PATH>());
+            if (has_costs()) m_Costs.resize(new_size.size(), s_DefaultCost);
+            notify_reset();
         }
     };
 
@@ -883,7 +1123,17 @@ namespace maze {
     class AbstractMazeGenerator {
 
     private:
-        inline static Random s_Random{};
+        static Random::result_type initial_seed() {
+            #ifdef DETERMINISTIC
+            return Random::default_seed;
+            #else
+            std::random_device device{};
+            return (static_cast<Random::result_type>(device()) << 32) | device();
+            #endif
+        }
+
+        // One per thread so generators can run side by side
+        inline static thread_local Random s_Random{ initial_seed() };
 
     protected:
         bool m_IsComplete = false;
@@ -917,7 +1167,19 @@ namespace maze {
             return s_Random;
         }
 
+        // Seeds the calling thread's generator; the same seed gives the same mazes
+        static void seed_random(const uint64_t seed) {
+            s_Random.seed(seed);
+        }
+
     public:
+        // Returns to the state before 'init' so another maze can be built; containers keep
+        // their capacity
+        virtual void reset() {
+            m_IsComplete = false;
+            m_IsInit     = false;
+        }
+
         virtual void init(Maze2D& maze) = 0;
         virtual void step(Maze2D& maze) = 0;
         virtual std::string get_display_name() = 0;
@@ -934,6 +1196,11 @@ namespace maze {
         Index2D m_CurrentPos{ 0, 0 };
 
     public:
+        virtual void reset() override {
+            AbstractMazeGenerator::reset();
+            m_CurrentPos = Index2D{ 0, 0 };
+        }
+
         virtual void init(Maze2D& maze) override {
 
         }
@@ -978,6 +1245,12 @@ namespace maze {
         PathSingleDirection(Cardinal dir = Cardinal::WEST) : m_Direction(dir) {}
 
     public:
+        virtual void reset() override {
+            AbstractMazeGenerator::reset();
+            m_Prev = Index2D{ 0, 0 };
+            m_Pos  = Index2D{ 0, 0 };
+        }
+
         virtual void init(Maze2D& maze) override {
 
         }
@@ -1017,9 +1290,14 @@ namespace maze {
     class RecursiveBacktrackImpl : public AbstractMazeGenerator {
 
     private:
-        std::stack<Index2D> m_Stack{};
+        std::stack<Index2D, std::vector<Index2D>> m_Stack{};
 
     public:
+        virtual void reset() override {
+            AbstractMazeGenerator::reset();
+            while (!m_Stack.empty()) m_Stack.pop();
+        }
+
         virtual void init(Maze2D& maze) override {
             m_Stack.emplace(
                     Distribution(0, maze.get_row_count() - 1)(get_random()),
@@ -1079,17 +1357,19 @@ namespace maze {
     class HuntAndKillBase : public AbstractMazeGenerator {
 
     protected:
-        Index2D             m_CurrentPosition{};
-        bool                m_IsRandomWalk = true;
-        std::deque<Index2D> m_UnvisitedCells{};
-        size_t              m_VisitedCount = 0;
+        Index2D              m_CurrentPosition{};
+        bool                 m_IsRandomWalk = true;
+        std::vector<Index2D> m_UnvisitedCells{};
+        size_t               m_HuntCursor   = 0;
+        size_t               m_VisitedCount = 0;
 
     private:
-        virtual void populate_cells(Maze2D& maze, std::deque<Index2D>& cells) {
+        virtual void populate_cells(Maze2D& maze, std::vector<Index2D>& cells) {
             m_UnvisitedCells.clear();
             maze.for_each_cell([&](Index2D pos, Cell cell) {
-                m_UnvisitedCells.push_front(pos);
+                m_UnvisitedCells.push_back(pos);
             });
+            std::reverse(m_UnvisitedCells.begin(), m_UnvisitedCells.end());
         }
 
         virtual Index2D get_starting_cell() {
@@ -1097,6 +1377,15 @@ namespace maze {
         }
 
     public:
+        virtual void reset() override {
+            AbstractMazeGenerator::reset();
+            m_CurrentPosition = Index2D{};
+            m_IsRandomWalk    = true;
+            m_UnvisitedCells.clear();
+            m_HuntCursor   = 0;
+            m_VisitedCount = 0;
+        }
+
         virtual void init(Maze2D& maze) override {
             populate_cells(maze, m_UnvisitedCells);
 
@@ -1140,12 +1429,11 @@ namespace maze {
                 m_CurrentPosition = m_CurrentPosition + cardinal_offset(dir);
                 unset_then_set_flags(m_CurrentPosition, maze, unset_group, set_group);
 
-                // Find a New Cell
+                // Find a New Cell; the hunt walks the cell list from back to front, wrapping
             } else {
                 Index2D prev_pos = m_CurrentPosition;
-                m_CurrentPosition = m_UnvisitedCells.back();
-                m_UnvisitedCells.pop_back();
-                m_UnvisitedCells.push_front(m_CurrentPosition);
+                if (m_HuntCursor == 0) m_HuntCursor = m_UnvisitedCells.size();
+                m_CurrentPosition = m_UnvisitedCells[--m_HuntCursor];
 
                 if (is_valid_cell(maze, m_CurrentPosition)) {
 
@@ -1224,7 +1512,7 @@ namespace maze {
 
     class RandomHuntAndKillImpl : public HuntAndKillBase {
 
-        virtual void populate_cells(Maze2D& maze, std::deque<Index2D>& cells) override {
+        virtual void populate_cells(Maze2D& maze, std::vector<Index2D>& cells) override {
             maze.for_each_cell([&](Index2D pos, auto) {
                 cells.push_back(pos);
             });
@@ -1232,7 +1520,7 @@ namespace maze {
         }
 
         virtual Index2D get_starting_cell() override {
-            std::uniform_int_distribution<size_t> index_dist{ 0, m_UnvisitedCells.size() };
+            std::uniform_int_distribution<size_t> index_dist{ 0, m_UnvisitedCells.size() - 1 };
             return m_UnvisitedCells.at(index_dist(get_random()));
         }
 
@@ -1244,7 +1532,7 @@ namespace maze {
 
     class StandardHuntAndKill : public HuntAndKillBase {
 
-        virtual void populate_cells(Maze2D& maze, std::deque<Index2D>& cells) override {
+        virtual void populate_cells(Maze2D& maze, std::vector<Index2D>& cells) override {
             Index row_max = maze.get_row_count();
             Index col_max = maze.get_col_count();
 
@@ -1279,31 +1567,45 @@ namespace maze {
 
     class KruskalImpl : public AbstractMazeGenerator {
 
-    public:
-        using Path = std::tuple<Index, Index>;
-        using PathSet = std::set<Path>;
-        using PathSetList = std::deque<PathSet>;
-
     private:
-        std::deque<Index2D>                   m_Positions;
-        PathSetList                           m_Paths;
+        // Cells are visited in a shuffled, repeating order; the sets of connected cells are a
+        // union-find over flat indices where a set of size one is a cell no path has reached.
+        std::vector<Index2D>                  m_Positions;
+        size_t                                m_Cursor     = 0;
+        std::vector<Index>                    m_Parents;
+        std::vector<Index>                    m_SetSizes;
+        size_t                                m_UnionCount = 0;
         std::array<Cardinal, s_CardinalCount> m_AllCardinals{ Cardinal::NORTH, Cardinal::EAST,
                                                               Cardinal::SOUTH, Cardinal::WEST };
 
     public:
+        virtual void reset() override {
+            AbstractMazeGenerator::reset();
+            m_Positions.clear();
+            m_Cursor       = 0;
+            m_UnionCount   = 0;
+            m_AllCardinals = s_AllCardinals;
+        }
+
         virtual void init(Maze2D& maze) override {
             // Get & Randomise all cells
+            m_Positions.clear();
             maze.for_each_cell([&](const Index2D& index, auto) {
-                m_Positions.push_front(index);
+                m_Positions.push_back(index);
             });
             std::shuffle(m_Positions.begin(), m_Positions.end(), get_random());
+
+            m_Parents.resize(maze.get_size());
+            std::iota(m_Parents.begin(), m_Parents.end(), 0);
+            m_SetSizes.assign(maze.get_size(), 1);
         }
 
         virtual void step(Maze2D& maze) override {
 
             if (is_complete()) return;
 
-            if (m_Paths.size() == 1 && m_Paths.front().size() == maze.get_size()) {
+            // A spanning tree joins every cell with one fewer union than there are cells
+            if (m_UnionCount + 1 >= maze.get_size()) {
                 HINFO("[KRUSKAL]", " # Maze Generation Finished...");
                 maze.set_flags_all<Flag::RED, Flag::GREEN, Flag::BLUE, Flag::FINISHED>();
                 m_IsComplete = true;
@@ -1311,16 +1613,16 @@ namespace maze {
             }
 
             // Get a Cell
-            Index2D cur_pos = m_Positions.front();
-            m_Positions.pop_front();
-            m_Positions.push_back(cur_pos);
+            const Index2D cur_pos = m_Positions[m_Cursor];
+            m_Cursor = (m_Cursor + 1) % m_Positions.size();
 
             // For the first Valid direction
+            const Index cols = maze.get_col_count();
             std::shuffle(m_AllCardinals.begin(), m_AllCardinals.end(), get_random());
             auto valid_dir = std::find_if(
                     m_AllCardinals.begin(), m_AllCardinals.end(),
                     [&](Cardinal dir) {
-                        return maze.inbounds(cur_pos, dir) && is_disjoint(cur_pos, dir);
+                        return maze.inbounds(cur_pos, dir) && is_disjoint(cur_pos, dir, cols);
                     }
             );
 
@@ -1330,62 +1632,46 @@ namespace maze {
             }
 
             // If we have a valid direction connect or create the set
-            Index2D               to_pos = cur_pos + cardinal_offset(*valid_dir);
-            PathSetList::iterator lhs    = find_set_containing(cur_pos);
-            PathSetList::iterator rhs    = find_set_containing(to_pos);
-            PathSetList::iterator end    = m_Paths.end();
+            const Index2D to_pos = cur_pos + cardinal_offset(*valid_dir);
+            const Index   lhs    = find_set(cur_pos.flat(cols));
+            const Index   rhs    = find_set(to_pos.flat(cols));
+            const bool    is_lhs = m_SetSizes[lhs] > 1;
+            const bool    is_rhs = m_SetSizes[rhs] > 1;
 
             // Create a Set; No Set is Valid
-            if (lhs == end && rhs == end) {
-                m_Paths.push_front(PathSet{ cur_pos.to_pair(), to_pos.to_pair() });
+            if (!is_lhs && !is_rhs) {
                 maze.set_flags(cur_pos, { Flag::GREEN });
                 maze.set_flags(to_pos, { Flag::GREEN });
 
-                // Both Sets are Valid
-            } else if (lhs != end && rhs != end) {
-
-                // Combine & Delete
-                lhs->merge(*rhs);
-                m_Paths.erase(rhs);
-
-                // One Set is Valid
-            } else {
-
-                const auto append_to_set = [&](PathSet& set, const Path& path) {
-                    set.insert(path);
-                    maze.set_flags({ std::get<0>(path), std::get<1>(path) }, { Flag::BLUE });
-                };
-
-                if (lhs != end) {
-                    append_to_set(*lhs, to_pos.to_pair());
-                } else {
-                    append_to_set(*rhs, cur_pos.to_pair());
-                }
+                // One Set is Valid; the other cell joins it
+            } else if (!is_lhs || !is_rhs) {
+                maze.set_flags(is_lhs ? to_pos : cur_pos, { Flag::BLUE });
             }
 
+            // Smaller set goes under the larger
+            const auto [root, child] = m_SetSizes[lhs] >= m_SetSizes[rhs]
+                                       ? std::pair{ lhs, rhs }
+                                       : std::pair{ rhs, lhs };
+            m_Parents[child] = root;
+            m_SetSizes[root] += m_SetSizes[child];
+            ++m_UnionCount;
+
             maze.make_path(cur_pos, *valid_dir);
         }
 
     private:
-        PathSetList::iterator find_set_containing(Index2D index) {
-            Path                       path = index.to_pair();
-            for (PathSetList::iterator it   = m_Paths.begin(); it != m_Paths.end(); ++it) {
-                if (it->contains(path)) {
-                    return it;
-                }
+        // Path halving
+        Index find_set(Index cell) {
+            while (m_Parents[cell] != cell) {
+                m_Parents[cell] = m_Parents[m_Parents[cell]];
+                cell = m_Parents[cell];
             }
-            return m_Paths.end();
+            return cell;
         }
 
-        bool is_disjoint(const Index2D& pos, Cardinal dir) {
-            PathSetList::iterator lhs = find_set_containing(pos);
-            PathSetList::iterator rhs = find_set_containing(pos + cardinal_offset(dir));
-            PathSetList::iterator end = m_Paths.end();
-
-            if (lhs != rhs) return true;
-            if (lhs == end && rhs == end) return true;
-            if (lhs == end || rhs == end) return true;
-            return false;
+        bool is_disjoint(const Index2D& pos, Cardinal dir, Index cols) {
+            const Index2D to_pos = pos + cardinal_offset(dir);
+            return find_set(pos.flat(cols)) != find_set(to_pos.flat(cols));
         }
 
     public:
@@ -0,0 +1,352 @@
+//
+// Header File: MazeDistanceField.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEDISTANCEFIELD_H
+#define MAZEVISUALISATION_MAZEDISTANCEFIELD_H
+
+#include "MazeConstructs.h"
+#include "MazeParallel.h"
+#include "MazeSolvers.h"
+
+#include <atomic>
+#include <bit>
+#include <mutex>
+
+namespace maze {
+
+    //############################################################################//
+    // | DISTANCE FIELD |
+    //############################################################################//
+
+    // Distance (in steps) from the source to every cell; flat indexed like Maze2D
+    using DistanceField = std::vector<uint32_t>;
+
+    inline static constexpr uint32_t s_Unreachable = UINT32_MAX;
+
+    //############################################################################//
+    // | DIRECTION OPTIMISING BREADTH FIRST SEARCH |
+    //############################################################################//
+
+    // Level synchronous BFS which expands each level either top-down (frontier cells claim their
+    // unvisited neighbours) or bottom-up (unvisited cells look for a neighbour in the frontier).
+    // Top-down keeps the frontier as a list of flat indices; bottom-up keeps it as a bitmap with
+    // every row padded to whole 64 bit words so that row bands never share a word. Each level is
+    // split across the thread pool once it is large enough to be worth it.
+    class DirectionOptimisingBfs {
+
+    public:
+        // Switch to bottom-up once the frontier exceeds (unvisited / Alpha)
+        inline static constexpr size_t s_Alpha             = 14;
+        // Switch back to top-down once the frontier drops below (cells / Beta)
+        inline static constexpr size_t s_Beta              = 24;
+        // Frontiers smaller than this are expanded on the calling thread
+        inline static constexpr size_t s_ParallelThreshold = 4096;
+        inline static constexpr size_t s_WordBits          = 64;
+
+    private:
+        ThreadPool&           m_Pool;
+        std::vector<uint64_t> m_Visited;
+        std::vector<uint64_t> m_Frontier;
+        std::vector<uint64_t> m_Next;
+        std::vector<Index>    m_Queue;
+        std::vector<Index>    m_NextQueue;
+        std::mutex            m_QueueMutex;
+        size_t                m_RowWords;
+        size_t                m_LevelCount;
+        size_t                m_BottomUpCount;
+
+    public:
+        explicit DirectionOptimisingBfs(
+                ThreadPool& pool = ThreadPool::get_shared()
+        ) : m_Pool(pool),
+            m_Visited(),
+            m_Frontier(),
+            m_Next(),
+            m_Queue(),
+            m_NextQueue(),
+            m_QueueMutex(),
+            m_RowWords(0),
+            m_LevelCount(0),
+            m_BottomUpCount(0) {};
+
+    public:
+        size_t get_level_count() const {
+            return m_LevelCount;
+        }
+
+        size_t get_bottom_up_level_count() const {
+            return m_BottomUpCount;
+        }
+
+        size_t get_state_bytes() const {
+            return (m_Visited.capacity() + m_Frontier.capacity() + m_Next.capacity())
+                   * sizeof(uint64_t)
+                   + (m_Queue.capacity() + m_NextQueue.capacity()) * sizeof(Index);
+        }
+
+        DistanceField compute(const Maze2D& maze, const Index2D source) {
+            DistanceField distances{};
+            compute(maze, source, distances);
+            return distances;
+        }
+
+        // Fills 'distances' with the step count from source; unreachable cells are s_Unreachable
+        void compute(const Maze2D& maze, const Index2D source, DistanceField& distances) {
+            if (!maze.inbounds(source)) {
+                HERR("[DIRECTION_OPTIMISING_BFS]", " # Source {}, {} is out of bounds.",
+                     source.row, source.col
+                );
+                throw std::exception();
+            }
+
+            const size_t cells = maze.get_size();
+            m_RowWords      = (static_cast<size_t>(maze.get_col_count()) + s_WordBits - 1)
+                              / s_WordBits;
+            m_LevelCount    = 0;
+            m_BottomUpCount = 0;
+
+            const size_t words = m_RowWords * static_cast<size_t>(maze.get_row_count());
+            distances.resize(cells);
+            m_Visited.resize(words);
+            m_Frontier.resize(words);
+            m_Next.resize(words);
+
+            m_Pool.parallel_for(cells, [&](size_t begin, size_t end) {
+                std::fill(distances.begin() + begin, distances.begin() + end, s_Unreachable);
+            }, 1 << 16);
+            clear_bitmap(m_Visited);
+
+            const Index flat = source.flat(maze.get_col_count());
+            distances[flat] = 0;
+            mark(m_Visited, source.row, source.col);
+            m_Queue.assign(1, flat);
+
+            size_t   frontier    = 1;
+            size_t   visited     = 1;
+            uint32_t level       = 0;
+            bool     is_top_down = true;
+
+            while (frontier > 0) {
+                ++m_LevelCount;
+
+                if (is_top_down) {
+                    frontier = expand_top_down(maze, distances, level + 1);
+
+                    if (frontier > (cells - visited - frontier) / s_Alpha
+                        && frontier >= s_ParallelThreshold) {
+                        queue_to_bitmap(maze);
+                        is_top_down = false;
+                    }
+
+                } else {
+                    ++m_BottomUpCount;
+                    frontier = expand_bottom_up(maze, distances, level + 1);
+
+                    if (frontier < cells / s_Beta) {
+                        bitmap_to_queue(maze);
+                        is_top_down = true;
+                    } else {
+                        m_Frontier.swap(m_Next);
+                    }
+                }
+
+                visited += frontier;
+                ++level;
+            }
+
+            HINFO("[DIRECTION_OPTIMISING_BFS]", " # Levels: {}, Bottom-Up: {}, Reached: {}",
+                  m_LevelCount, m_BottomUpCount, visited
+            );
+        }
+
+    private:
+
+        //############################################################################//
+        // | BITMAP UTILITY |
+        //############################################################################//
+
+        size_t word_of(const Index row, const Index col) const {
+            return static_cast<size_t>(row) * m_RowWords + static_cast<size_t>(col) / s_WordBits;
+        }
+
+        bool test(const std::vector<uint64_t>& bitmap, const Index row, const Index col) const {
+            return (bitmap[word_of(row, col)] >> (static_cast<size_t>(col) % s_WordBits)) & 1U;
+        }
+
+        void mark(std::vector<uint64_t>& bitmap, const Index row, const Index col) const {
+            bitmap[word_of(row, col)] |= uint64_t{ 1 } << (static_cast<size_t>(col) % s_WordBits);
+        }
+
+        // Valid (in bounds) bits of the word at the given offset within a row
+        uint64_t row_mask(const Maze2D& maze, const size_t word) const {
+            const size_t tail = static_cast<size_t>(maze.get_col_count()) % s_WordBits;
+            if (word + 1 < m_RowWords || tail == 0) return ~uint64_t{ 0 };
+            return (uint64_t{ 1 } << tail) - 1;
+        }
+
+        void clear_bitmap(std::vector<uint64_t>& bitmap) {
+            m_Pool.parallel_for(bitmap.size(), [&](size_t begin, size_t end) {
+                std::fill(bitmap.begin() + begin, bitmap.begin() + end, 0);
+            }, 1 << 14);
+        }
+
+        //############################################################################//
+        // | TOP-DOWN |
+        //############################################################################//
+
+        size_t expand_top_down(const Maze2D& maze, DistanceField& distances, uint32_t depth) {
+            const Index cols = maze.get_col_count();
+            m_NextQueue.clear();
+
+            if (m_Queue.size() < s_ParallelThreshold) {
+                for (const Index pos : m_Queue) {
+                    for_each_open(maze, pos, [&](Cardinal, const Index next) {
+                        const Index row = next / cols;
+                        const Index col = next - row * cols;
+                        if (test(m_Visited, row, col)) return;
+
+                        mark(m_Visited, row, col);
+                        distances[next] = depth;
+                        m_NextQueue.push_back(next);
+                    });
+                }
+
+            } else {
+                m_Pool.parallel_for(m_Queue.size(), [&](size_t begin, size_t end) {
+                    thread_local std::vector<Index> local{};
+                    local.clear();
+
+                    for (size_t i = begin; i < end; ++i) {
+                        for_each_open(maze, m_Queue[i], [&](Cardinal, const Index next) {
+                            const Index    row = next / cols;
+                            const Index    col = next - row * cols;
+                            const uint64_t bit = uint64_t{ 1 } << (col % s_WordBits);
+
+                            // Claim the cell; only the thread which sets the bit records it
+                            std::atomic_ref<uint64_t> word{ m_Visited[word_of(row, col)] };
+                            if ((word.load(std::memory_order_relaxed) & bit) != 0) return;
+                            if ((word.fetch_or(bit, std::memory_order_relaxed) & bit) != 0) return;
+
+                            distances[next] = depth;
+                            local.push_back(next);
+                        });
+                    }
+
+                    std::lock_guard lock{ m_QueueMutex };
+                    m_NextQueue.insert(m_NextQueue.end(), local.begin(), local.end());
+                }, 1024);
+            }
+
+            m_Queue.swap(m_NextQueue);
+            return m_Queue.size();
+        }
+
+        //############################################################################//
+        // | BOTTOM-UP |
+        //############################################################################//
+
+        size_t expand_bottom_up(const Maze2D& maze, DistanceField& distances, uint32_t depth) {
+            const Index         rows  = maze.get_row_count();
+            const Index         cols  = maze.get_col_count();
+            const Cell*         data  = maze.get_cell_data();
+            std::atomic<size_t> found = 0;
+
+            // Row bands only write to their own rows of Visited & Next; Frontier is read only
+            m_Pool.for_each_row_band(maze, [&](const Index row_begin, const Index row_end) {
+                size_t local = 0;
+
+                for (Index row = row_begin; row < row_end; ++row) {
+                    const size_t base = static_cast<size_t>(row) * m_RowWords;
+
+                    for (size_t w = 0; w < m_RowWords; ++w) {
+                        const size_t word = base + w;
+                        m_Next[word] = 0;
+
+                        const uint64_t unvisited = ~m_Visited[word] & row_mask(maze, w);
+                        if (unvisited == 0) continue;
+
+                        // Cells with any frontier neighbour, ignoring walls
+                        const uint64_t here  = m_Frontier[word];
+                        const uint64_t prev  = w > 0 ? m_Frontier[word - 1] : 0;
+                        const uint64_t next  = w + 1 < m_RowWords ? m_Frontier[word + 1] : 0;
+                        const uint64_t north = row > 0 ? m_Frontier[word - m_RowWords] : 0;
+                        const uint64_t south = row + 1 < rows ? m_Frontier[word + m_RowWords] : 0;
+                        const uint64_t west  = (here << 1) | (prev >> 63);
+                        const uint64_t east  = (here >> 1) | (next << 63);
+
+                        uint64_t candidates = unvisited & (north | south | west | east);
+                        while (candidates != 0) {
+                            const size_t   bit  = std::countr_zero(candidates);
+                            const uint64_t mask = uint64_t{ 1 } << bit;
+                            candidates &= candidates - 1;
+
+                            const Index col  = static_cast<Index>(w * s_WordBits + bit);
+                            const Index flat = row * cols + col;
+                            const Cell  cell = data[flat];
+
+                            const bool is_reached =
+                                    ((north & mask) && is_set<Flag::PATH_NORTH>(cell))
+                                    || ((south & mask) && is_set<Flag::PATH_SOUTH>(cell))
+                                    || ((west & mask) && is_set<Flag::PATH_WEST>(cell))
+                                    || ((east & mask) && is_set<Flag::PATH_EAST>(cell));
+                            if (!is_reached) continue;
+
+                            distances[flat] = depth;
+                            m_Visited[word] |= mask;
+                            m_Next[word] |= mask;
+                            ++local;
+                        }
+                    }
+                }
+
+                found.fetch_add(local, std::memory_order_relaxed);
+            }, 16);
+
+            return found.load();
+        }
+
+        //############################################################################//
+        // | FRONTIER CONVERSION |
+        //############################################################################//
+
+        void queue_to_bitmap(const Maze2D& maze) {
+            const Index cols = maze.get_col_count();
+            clear_bitmap(m_Frontier);
+            for (const Index pos : m_Queue) {
+                const Index row = pos / cols;
+                mark(m_Frontier, row, pos - row * cols);
+            }
+        }
+
+        void bitmap_to_queue(const Maze2D& maze) {
+            const Index cols = maze.get_col_count();
+            m_Queue.clear();
+
+            m_Pool.for_each_row_band(maze, [&](const Index row_begin, const Index row_end) {
+                thread_local std::vector<Index> local{};
+                local.clear();
+
+                for (Index row = row_begin; row < row_end; ++row) {
+                    for (size_t w = 0; w < m_RowWords; ++w) {
+                        uint64_t bits = m_Next[static_cast<size_t>(row) * m_RowWords + w];
+                        while (bits != 0) {
+                            const size_t bit = std::countr_zero(bits);
+                            bits &= bits - 1;
+                            local.push_back(row * cols + static_cast<Index>(w * s_WordBits + bit));
+                        }
+                    }
+                }
+
+                std::lock_guard lock{ m_QueueMutex };
+                m_Queue.insert(m_Queue.end(), local.begin(), local.end());
+            }, 16);
+        }
+    };
+
+} // maze
+
+#endif
@@ -0,0 +1,213 @@
+//
+// Header File: MazeDynamicField.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeDynamicField.h"
+
+namespace maze {
+
+    DynamicDistanceField::DynamicDistanceField(
+            Maze2D& maze,
+            const Index2D source
+    ) : m_Maze(&maze),
+        m_Bounds(maze.get_bounds()),
+        m_Source(0),
+        m_Distances(),
+        m_Queue(),
+        m_Changed(),
+        m_Bfs(),
+        m_WasRebuilt(false),
+        m_RebuildCount(0),
+        m_RepairCount(0) {
+        maze.check_index(source);
+        m_Source = source.flat(m_Bounds.col);
+        rebuild();
+        maze.add_listener(this);
+    }
+
+    DynamicDistanceField::~DynamicDistanceField() {
+        m_Maze->remove_listener(this);
+    }
+
+    //############################################################################//
+    // | WALL EVENTS |
+    //############################################################################//
+
+    void DynamicDistanceField::on_path_made(
+            const Maze2D&,
+            const Index2D pos,
+            const Cardinal dir
+    ) {
+        const Index    from  = pos.flat(m_Bounds.col);
+        const Index    to    = from + flat_offset(dir, m_Bounds.col);
+        const uint32_t dfrom = m_Distances[from];
+        const uint32_t dto   = m_Distances[to];
+
+        m_Changed.clear();
+        m_WasRebuilt = false;
+        ++m_RepairCount;
+
+        // At most one side can improve, through the other
+        if (dfrom != s_Unreachable && dfrom + 1 < dto) {
+            propagate(to, dfrom + 1);
+        } else if (dto != s_Unreachable && dto + 1 < dfrom) {
+            propagate(from, dto + 1);
+        }
+        on_field_changed();
+    }
+
+    void DynamicDistanceField::on_maze_reset(const Maze2D& maze) {
+        const Index2D source{ m_Source / m_Bounds.col, m_Source % m_Bounds.col };
+        m_Bounds = maze.get_bounds();
+
+        // Keep the source inside the (possibly) resized maze
+        const Index2D clamped{
+                std::min(source.row, m_Bounds.row - 1),
+                std::min(source.col, m_Bounds.col - 1)
+        };
+        m_Source = clamped.flat(m_Bounds.col);
+        rebuild();
+    }
+
+    void DynamicDistanceField::set_source(const Index2D source) {
+        m_Maze->check_index(source);
+        m_Source = source.flat(m_Bounds.col);
+        rebuild();
+    }
+
+    //############################################################################//
+    // | FIELD MAINTENANCE |
+    //############################################################################//
+
+    void DynamicDistanceField::rebuild() {
+        m_Bfs.compute(*m_Maze, Index2D{ m_Source / m_Bounds.col, m_Source % m_Bounds.col },
+                      m_Distances);
+        m_Changed.clear();
+        m_WasRebuilt = true;
+        ++m_RebuildCount;
+        on_field_changed();
+    }
+
+    void DynamicDistanceField::propagate(const Index seed, const uint32_t distance) {
+        const Maze2D& maze = *m_Maze;
+        m_Queue.clear();
+
+        m_Distances[seed] = distance;
+        m_Changed.push_back(seed);
+        m_Queue.push(seed);
+
+        // Single seed & unit weights; FIFO order settles each improved cell once
+        while (!m_Queue.empty()) {
+            const Index    pos  = m_Queue.pop();
+            const uint32_t next = m_Distances[pos] + 1;
+
+            for_each_open(maze, pos, [&](Cardinal, const Index neighbour) {
+                if (next >= m_Distances[neighbour]) return;
+                m_Distances[neighbour] = next;
+                m_Changed.push_back(neighbour);
+                m_Queue.push(neighbour);
+            });
+        }
+    }
+
+    std::vector<Index> DynamicDistanceField::path_to(const Index2D target) const {
+        m_Maze->check_index(target);
+
+        std::vector<Index> path{};
+        Index              pos = target.flat(m_Bounds.col);
+        if (m_Distances[pos] == s_Unreachable) return path;
+
+        path.reserve(m_Distances[pos] + 1);
+        path.push_back(pos);
+        while (pos != m_Source) {
+            const uint32_t expected = m_Distances[pos] - 1;
+            for_each_open(*m_Maze, pos, [&](Cardinal, const Index neighbour) {
+                if (m_Distances[neighbour] == expected) pos = neighbour;
+            });
+            path.push_back(pos);
+        }
+
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    //############################################################################//
+    // | FLOW FIELD |
+    //############################################################################//
+
+    FlowField::FlowField(
+            Maze2D& maze,
+            const Index2D goal
+    ) : DynamicDistanceField(maze, goal),
+        m_Directions() {
+        rebuild_directions();
+    }
+
+    void FlowField::on_field_changed() {
+        // The base constructor's first build runs before the plane exists
+        if (m_Directions.get_size() != get_distances().size() || was_rebuilt()) {
+            rebuild_directions();
+            return;
+        }
+
+        for (const Index flat : get_changed_cells()) m_Directions.set(flat, downhill(flat));
+    }
+
+    Cardinal FlowField::downhill(const Index flat) const {
+        const DistanceField& distances = get_distances();
+        const uint32_t       distance  = distances[flat];
+        Cardinal             best      = Cardinal::NORTH;
+        if (distance == s_Unreachable || distance == 0) return best;
+
+        for_each_open(get_maze(), flat, [&](const Cardinal dir, const Index neighbour) {
+            if (distances[neighbour] + 1 == distance) best = dir;
+        });
+        return best;
+    }
+
+    void FlowField::rebuild_directions() {
+        const size_t cells = get_distances().size();
+        m_Directions.resize(cells);
+
+        // Each range owns whole words so no two threads share one
+        ThreadPool::get_shared().parallel_for(
+                m_Directions.get_word_count(),
+                [&](const size_t begin, const size_t end) {
+                    for (size_t word = begin; word < end; ++word) {
+                        const size_t first = word * 32;
+                        const size_t last  = std::min(cells, first + 32);
+                        uint64_t     bits  = 0;
+                        for (size_t i = first; i < last; ++i) {
+                            const Cardinal dir = downhill(static_cast<Index>(i));
+                            bits |= static_cast<uint64_t>(dir) << ((i - first) * 2);
+                        }
+                        m_Directions.set_word(word, bits);
+                    }
+                },
+                1024
+        );
+    }
+
+    size_t FlowField::advance(std::vector<Index>& agents) const {
+        std::atomic<size_t> arrived{ 0 };
+
+        ThreadPool::get_shared().parallel_for(
+                agents.size(),
+                [&](const size_t begin, const size_t end) {
+                    size_t count = 0;
+                    for (size_t i = begin; i < end; ++i) {
+                        agents[i] = next_cell(agents[i]);
+                        if (agents[i] == get_source()) ++count;
+                    }
+                    arrived.fetch_add(count, std::memory_order_relaxed);
+                },
+                s_ParallelAgents
+        );
+
+        return arrived.load();
+    }
+
+} // maze
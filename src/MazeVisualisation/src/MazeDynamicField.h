@@ -0,0 +1,179 @@
+//
+// Header File: MazeDynamicField.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEDYNAMICFIELD_H
+#define MAZEVISUALISATION_MAZEDYNAMICFIELD_H
+
+#include "MazeConstructs.h"
+#include "MazeDistanceField.h"
+#include "MazeSolvers.h"
+
+namespace maze {
+
+    //############################################################################//
+    // | DYNAMIC DISTANCE FIELD |
+    //############################################################################//
+
+    // Distance field from a source cell which subscribes to the maze and repairs itself as walls
+    // are opened. Opening a wall can only shorten distances so a repair is a BFS seeded at the
+    // far side of the new opening which stops as soon as no neighbour improves; only the cells
+    // whose distance actually dropped are visited. A reset (or any wholesale rewrite of the maze)
+    // falls back to a full (direction optimising) recompute.
+    //
+    // Not copyable; the field unsubscribes on destruction and must not outlive the maze.
+    class DynamicDistanceField : public WallListener {
+
+    private:
+        Maze2D*                m_Maze;
+        Index2D                m_Bounds;
+        Index                  m_Source;
+        DistanceField          m_Distances;
+        IndexRingBuffer        m_Queue;
+        std::vector<Index>     m_Changed;
+        DirectionOptimisingBfs m_Bfs;
+        bool                   m_WasRebuilt;
+        size_t                 m_RebuildCount;
+        size_t                 m_RepairCount;
+
+    public:
+        DynamicDistanceField(Maze2D& maze, Index2D source);
+        ~DynamicDistanceField() override;
+
+        DynamicDistanceField(const DynamicDistanceField&) = delete;
+        DynamicDistanceField& operator =(const DynamicDistanceField&) = delete;
+
+    public:
+        void on_path_made(const Maze2D& maze, Index2D pos, Cardinal dir) override;
+        void on_maze_reset(const Maze2D& maze) override;
+
+        Index2D get_bounds() const {
+            return m_Bounds;
+        }
+
+        // Moves the source; always a full recompute
+        void set_source(Index2D source);
+
+        // Flat cells from the source to 'target' (inclusive) by descending the field; no search
+        std::vector<Index> path_to(Index2D target) const;
+
+    public:
+        uint32_t get_distance(const Index2D pos) const {
+            return m_Distances[pos.flat(m_Bounds.col)];
+        }
+
+        const DistanceField& get_distances() const {
+            return m_Distances;
+        }
+
+        Index get_source() const {
+            return m_Source;
+        }
+
+        // Cells whose distance dropped in the last repair; empty after a rebuild
+        const std::vector<Index>& get_changed_cells() const {
+            return m_Changed;
+        }
+
+        // True if the last change was handled by a full recompute
+        bool was_rebuilt() const {
+            return m_WasRebuilt;
+        }
+
+        size_t get_rebuild_count() const {
+            return m_RebuildCount;
+        }
+
+        size_t get_repair_count() const {
+            return m_RepairCount;
+        }
+
+        size_t get_state_bytes() const {
+            return m_Distances.capacity() * sizeof(uint32_t)
+                   + m_Changed.capacity() * sizeof(Index)
+                   + m_Queue.get_bytes()
+                   + m_Bfs.get_state_bytes();
+        }
+
+    protected:
+        const Maze2D& get_maze() const {
+            return *m_Maze;
+        }
+
+        // Invoked after every rebuild or repair; see was_rebuilt() & get_changed_cells()
+        virtual void on_field_changed() {}
+
+    private:
+        void rebuild();
+        void propagate(Index seed, uint32_t distance);
+    };
+
+    //############################################################################//
+    // | FLOW FIELD |
+    //############################################################################//
+
+    // One 2 bit 'next direction' per cell pointing one step closer to the goal (the source of the
+    // underlying dynamic field) so any number of agents navigate by a lookup each. When a wall
+    // opens only cells whose distance dropped can need a new direction; any other cell keeps a
+    // neighbour exactly one step closer, so repairs rewrite just the changed cells. Rebuilds fill
+    // whole 32 cell words in parallel.
+    class FlowField : public DynamicDistanceField {
+
+    public:
+        inline static constexpr size_t s_ParallelAgents = 4096;
+
+    private:
+        DirectionPlane m_Directions;
+
+    public:
+        FlowField(Maze2D& maze, Index2D goal);
+
+    public:
+        void set_goal(const Index2D goal) {
+            set_source(goal);
+        }
+
+        Index get_goal() const {
+            return get_source();
+        }
+
+        bool is_reachable(const Index flat) const {
+            return get_distances()[flat] != s_Unreachable;
+        }
+
+        // Direction to step from the cell; only meaningful if reachable & not the goal
+        Cardinal get_direction(const Index flat) const {
+            return m_Directions.get(flat);
+        }
+
+        // The neighbour one step closer to the goal; the cell itself at the goal or if unreachable
+        Index next_cell(const Index flat) const {
+            if (flat == get_source() || !is_reachable(flat)) return flat;
+            return flat + flat_offset(m_Directions.get(flat), get_bounds().col);
+        }
+
+        // Moves every agent one step along the field; returns how many are at the goal
+        size_t advance(std::vector<Index>& agents) const;
+
+        const DirectionPlane& get_directions() const {
+            return m_Directions;
+        }
+
+        size_t get_state_bytes() const {
+            return DynamicDistanceField::get_state_bytes() + m_Directions.get_bytes();
+        }
+
+    protected:
+        void on_field_changed() override;
+
+    private:
+        Cardinal downhill(Index flat) const;
+        void rebuild_directions();
+    };
+
+} // maze
+
+#endif
@@ -0,0 +1,491 @@
+//
+// Header File: MazeFile.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeFile.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace maze {
+
+    //############################################################################//
+    // | MEMORY MAPPED FILE |
+    //############################################################################//
+
+#ifdef _WIN32
+
+    MappedFile::MappedFile(
+            const std::string& path
+    ) : m_Data(nullptr),
+        m_Size(0),
+        m_File(INVALID_HANDLE_VALUE),
+        m_Mapping(nullptr) {
+
+        m_File = CreateFileA(
+                path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+        );
+
+        LARGE_INTEGER size{};
+        if (m_File == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_File, &size)) {
+            HERR("[MAPPED_FILE]", " # Failed to open '{}'...", path);
+            throw std::exception();
+        }
+
+        m_Size = static_cast<size_t>(size.QuadPart);
+        if (m_Size == 0) return;
+
+        m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_Mapping != nullptr) {
+            m_Data = static_cast<const uint8_t*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+
+        if (m_Data == nullptr) {
+            HERR("[MAPPED_FILE]", " # Failed to map '{}' ({} bytes)...", path, m_Size);
+            if (m_Mapping != nullptr) CloseHandle(m_Mapping);
+            CloseHandle(m_File);
+            throw std::exception();
+        }
+    }
+
+    MappedFile::~MappedFile() {
+        if (m_Data != nullptr) UnmapViewOfFile(m_Data);
+        if (m_Mapping != nullptr) CloseHandle(m_Mapping);
+        if (m_File != INVALID_HANDLE_VALUE) CloseHandle(m_File);
+    }
+
+    void MappedFile::advise(Access, size_t, size_t) const {
+        // No madvise equivalent worth using; the Win32 cache manager detects sequential access
+    }
+
+#else
+
+    MappedFile::MappedFile(
+            const std::string& path
+    ) : m_Data(nullptr),
+        m_Size(0),
+        m_File(-1) {
+
+        m_File = ::open(path.c_str(), O_RDONLY);
+        struct stat info{};
+        if (m_File < 0 || ::fstat(m_File, &info) != 0) {
+            HERR("[MAPPED_FILE]", " # Failed to open '{}'...", path);
+            if (m_File >= 0) ::close(m_File);
+            throw std::exception();
+        }
+
+        m_Size = static_cast<size_t>(info.st_size);
+        if (m_Size == 0) return;
+
+        void* data = ::mmap(nullptr, m_Size, PROT_READ, MAP_SHARED, m_File, 0);
+        if (data == MAP_FAILED) {
+            HERR("[MAPPED_FILE]", " # Failed to map '{}' ({} bytes)...", path, m_Size);
+            ::close(m_File);
+            throw std::exception();
+        }
+        m_Data = static_cast<const uint8_t*>(data);
+    }
+
+    MappedFile::~MappedFile() {
+        if (m_Data != nullptr) ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+        if (m_File >= 0) ::close(m_File);
+    }
+
+    void MappedFile::advise(const Access access, const size_t offset, const size_t length) const {
+        if (m_Data == nullptr || offset >= m_Size) return;
+
+        // madvise wants a page aligned start
+        const size_t page  = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t begin = offset - offset % page;
+        const size_t end   = length >= m_Size - offset ? m_Size : offset + length;
+
+        int advice = MADV_NORMAL;
+        switch (access) {
+            case Access::NORMAL:
+                advice = MADV_NORMAL;
+                break;
+            case Access::SEQUENTIAL:
+                advice = MADV_SEQUENTIAL;
+                break;
+            case Access::RANDOM:
+                advice = MADV_RANDOM;
+                break;
+            case Access::WILL_NEED:
+                advice = MADV_WILLNEED;
+                break;
+        }
+        ::madvise(const_cast<uint8_t*>(m_Data) + begin, end - begin, advice);
+    }
+
+#endif
+
+    //############################################################################//
+    // | MAZE FILE |
+    //############################################################################//
+
+    static size_t payload_bytes(const MazeLayout layout, const Index2D bounds) {
+        const size_t cells = static_cast<size_t>(bounds.row) * static_cast<size_t>(bounds.col);
+        switch (layout) {
+            case MazeLayout::NIBBLES:
+                return (cells + 1) / 2;
+            case MazeLayout::CELLS:
+                return cells * sizeof(Cell);
+            case MazeLayout::FROZEN:
+                return FrozenMazeView::word_count(bounds) * sizeof(uint64_t);
+        }
+        return 0;
+    }
+
+    // 'available' bytes of the file start are at 'data'; 'file_size' is the size of the whole file
+    static MazeFileHeader parse_header(
+            const uint8_t* data,
+            const size_t available,
+            const size_t file_size
+    ) {
+        MazeFileHeader header{};
+        if (available < s_MazeFileV1HeaderSize) {
+            HERR("[MAZE_FILE]", " # File is too small to hold a header ({} bytes)...", file_size);
+            throw std::exception();
+        }
+        std::memcpy(&header, data, s_MazeFileV1HeaderSize);
+
+        const bool is_v1 = header.version == 1;
+        if (header.magic != s_MazeFileMagic || (!is_v1 && header.version != s_MazeFileVersion)) {
+            HERR("[MAZE_FILE]", " # Unsupported maze file; magic {:x}, version {}",
+                 header.magic, header.version);
+            throw std::exception();
+        }
+
+        const Index2D bounds{ header.rows, header.cols };
+        if (is_v1) {
+            header.layout         = static_cast<uint32_t>(MazeLayout::NIBBLES);
+            header.generator      = s_UnknownGenerator;
+            header.payload_offset = s_MazeFileV1HeaderSize;
+            header.payload_bytes  = payload_bytes(MazeLayout::NIBBLES, bounds);
+        } else if (available >= sizeof(MazeFileHeader)) {
+            std::memcpy(&header, data, sizeof(MazeFileHeader));
+        } else {
+            HERR("[MAZE_FILE]", " # Version 2 header is truncated ({} bytes)...", file_size);
+            throw std::exception();
+        }
+
+        const auto layout = static_cast<MazeLayout>(header.layout);
+        if (header.layout > static_cast<uint32_t>(MazeLayout::FROZEN)
+            || header.rows <= 0 || header.cols <= 0
+            || header.payload_bytes != payload_bytes(layout, bounds)
+            || (!is_v1 && header.payload_offset % s_MazeFileAlignment != 0)
+            || header.payload_offset < (is_v1 ? s_MazeFileV1HeaderSize : sizeof(MazeFileHeader))
+            || header.payload_offset > file_size
+            || header.payload_bytes > file_size - header.payload_offset) {
+            HERR("[MAZE_FILE]", " # Maze file of {} x {} is truncated or invalid ({} bytes)...",
+                 header.rows, header.cols, file_size);
+            throw std::exception();
+        }
+        return header;
+    }
+
+    MazeFileHeader check_maze_file(const uint8_t* data, const size_t size) {
+        return parse_header(data, size, size);
+    }
+
+    MazeFileHeader make_maze_file_header(
+            const Index2D bounds,
+            const MazeLayout layout,
+            const MazeFileInfo& info
+    ) {
+        // The header is exactly one alignment unit so the payload follows it directly
+        MazeFileHeader header{};
+        header.magic          = s_MazeFileMagic;
+        header.version        = s_MazeFileVersion;
+        header.rows           = bounds.row;
+        header.cols           = bounds.col;
+        header.layout         = static_cast<uint32_t>(layout);
+        header.generator      = info.generator;
+        header.seed           = info.seed;
+        header.payload_offset = sizeof(MazeFileHeader);
+        header.payload_bytes  = payload_bytes(layout, bounds);
+        return header;
+    }
+
+    // Reads & checks the header at the start of 'stream', leaving the read position undefined
+    static MazeFileHeader read_header(std::istream& stream, const std::string& path) {
+        std::array<uint8_t, sizeof(MazeFileHeader)> bytes{};
+        stream.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+        const auto available = static_cast<size_t>(stream.gcount());
+        if (stream.bad() || available == 0) {
+            HERR("[MAZE_FILE]", " # Failed to read a header from '{}'...", path);
+            throw std::exception();
+        }
+
+        stream.clear();
+        stream.seekg(0, std::ios::end);
+        return parse_header(bytes.data(), available, static_cast<size_t>(stream.tellg()));
+    }
+
+    MazeFileHeader read_maze_file_header(const std::string& path) {
+        std::ifstream stream{ path, std::ios::binary };
+        return read_header(stream, path);
+    }
+
+    //############################################################################//
+    // | WRITING |
+    //############################################################################//
+
+    static std::ofstream open_maze_file(
+            const std::string& path,
+            const Index2D bounds,
+            const MazeLayout layout,
+            const MazeFileInfo& info
+    ) {
+        std::ofstream stream{ path, std::ios::binary | std::ios::trunc };
+        if (!stream) {
+            HERR("[MAZE_FILE]", " # Failed to open '{}' for writing...", path);
+            throw std::exception();
+        }
+
+        const MazeFileHeader header = make_maze_file_header(bounds, layout, info);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(MazeFileHeader));
+        return stream;
+    }
+
+    // Payloads already in memory go out in large slices straight from the source
+    static void write_payload(std::ofstream& stream, const void* data, const size_t size) {
+        const auto* bytes = static_cast<const char*>(data);
+        for (size_t offset = 0; offset < size; offset += s_MazeFileWriteSize) {
+            const size_t length = std::min(s_MazeFileWriteSize, size - offset);
+            stream.write(bytes + offset, static_cast<std::streamsize>(length));
+        }
+    }
+
+    static void close_maze_file(std::ofstream& stream, const std::string& path) {
+        stream.flush();
+        if (!stream) {
+            HERR("[MAZE_FILE]", " # Failed writing '{}'...", path);
+            throw std::exception();
+        }
+    }
+
+    void write_maze_file(
+            const Maze2D& maze,
+            const std::string& path,
+            const MazeLayout layout,
+            const MazeFileInfo& info
+    ) {
+        if (layout == MazeLayout::FROZEN) {
+            const FrozenMaze frozen{ maze };
+            write_maze_file(frozen.get_view(), path, info);
+            return;
+        }
+
+        std::ofstream stream = open_maze_file(path, maze.get_bounds(), layout, info);
+        const Cell*   cells  = maze.get_cell_data();
+        const size_t  count  = maze.get_size();
+
+        if (layout == MazeLayout::CELLS) {
+            write_payload(stream, cells, count * sizeof(Cell));
+            close_maze_file(stream, path);
+            return;
+        }
+
+        std::vector<uint8_t> buffer{};
+        buffer.reserve(s_MazeFileWriteSize);
+        for (size_t i = 0; i < count; i += 2) {
+            const uint8_t high = i + 1 < count ? openings_of(cells[i + 1]) : 0;
+            buffer.push_back(static_cast<uint8_t>(openings_of(cells[i]) | (high << 4)));
+
+            if (buffer.size() == s_MazeFileWriteSize) {
+                stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+                buffer.clear();
+            }
+        }
+        stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        close_maze_file(stream, path);
+    }
+
+    void write_maze_file(
+            const FrozenMazeView& maze,
+            const std::string& path,
+            const MazeFileInfo& info
+    ) {
+        std::ofstream stream = open_maze_file(path, maze.get_bounds(), MazeLayout::FROZEN, info);
+        const size_t  bytes  = FrozenMazeView::word_count(maze.get_bounds()) * sizeof(uint64_t);
+        write_payload(stream, maze.get_words(), bytes);
+        close_maze_file(stream, path);
+    }
+
+    //############################################################################//
+    // | READING |
+    //############################################################################//
+
+    Maze2D read_maze_file(const std::string& path) {
+        const MappedMazeFile file{ path };
+        file.get_file().advise(MappedFile::Access::SEQUENTIAL);
+
+        switch (file.get_layout()) {
+            case MazeLayout::FROZEN:
+                return file.get_frozen_view().thaw();
+
+            case MazeLayout::CELLS: {
+                const ConstMazeView view = file.get_view();
+                Maze2D              maze{ view.get_row_count(), view.get_col_count() };
+                std::copy(view.get_row_data(0), view.get_row_data(0) + view.get_size(),
+                          maze.begin());
+                maze.rehash();
+                return maze;
+            }
+
+            case MazeLayout::NIBBLES:
+                break;
+        }
+
+        const Index2D bounds = file.get_bounds();
+        Maze2D        maze{ bounds.row, bounds.col };
+        auto          cell   = maze.begin();
+        for (Index row = 0; row < bounds.row; ++row) {
+            for (Index col = 0; col < bounds.col; ++col, ++cell) {
+                const uint8_t openings = file.get_openings(Index2D{ row, col });
+                *cell = openings == 0
+                        ? cellof<Flag::EMPTY_PATH>()
+                        : static_cast<Cell>(openings) << 1;
+            }
+        }
+        maze.rehash();
+        return maze;
+    }
+
+    //############################################################################//
+    // | MAZE FILE VIEWS |
+    //############################################################################//
+
+    MappedMazeFile::MappedMazeFile(
+            const std::string& path
+    ) : m_File(path),
+        m_Header(),
+        m_Bounds{ 0, 0 },
+        m_Layout(MazeLayout::NIBBLES),
+        m_Payload(nullptr) {
+        m_Header  = check_maze_file(m_File.data(), m_File.size());
+        m_Bounds  = Index2D{ m_Header.rows, m_Header.cols };
+        m_Layout  = static_cast<MazeLayout>(m_Header.layout);
+        m_Payload = m_File.data() + m_Header.payload_offset;
+    }
+
+    void MappedMazeFile::check_layout(const MazeLayout layout) const {
+        if (m_Layout != layout) {
+            HERR("[MAZE_FILE]", " # Maze file has layout {} not {}...",
+                 static_cast<uint32_t>(m_Layout), static_cast<uint32_t>(layout));
+            throw std::exception();
+        }
+    }
+
+    ConstMazeView MappedMazeFile::get_view() const {
+        check_layout(MazeLayout::CELLS);
+        return ConstMazeView{ reinterpret_cast<const Cell*>(m_Payload), m_Bounds };
+    }
+
+    FrozenMazeView MappedMazeFile::get_frozen_view() const {
+        check_layout(MazeLayout::FROZEN);
+        return FrozenMazeView{ m_Bounds, reinterpret_cast<const uint64_t*>(m_Payload) };
+    }
+
+    PagedMazeFile::PagedMazeFile(
+            const std::string& path,
+            const size_t budget
+    ) : m_Stream(path, std::ios::binary),
+        m_Bounds{ 0, 0 },
+        m_Layout(MazeLayout::NIBBLES),
+        m_PayloadOffset(0),
+        m_PayloadBytes(0),
+        m_Pages(std::max(budget, s_PageSize)),
+        m_LastPage(SIZE_MAX),
+        m_LastData(nullptr),
+        m_PageReads(0) {
+
+        const MazeFileHeader header = read_header(m_Stream, path);
+        m_Bounds        = Index2D{ header.rows, header.cols };
+        m_Layout        = static_cast<MazeLayout>(header.layout);
+        m_PayloadOffset = header.payload_offset;
+        m_PayloadBytes  = header.payload_bytes;
+    }
+
+    void PagedMazeFile::load_page(const size_t page) {
+        std::vector<uint8_t>* data = m_Pages.find(page);
+
+        if (data == nullptr) {
+            const size_t         offset = page * s_PageSize;
+            std::vector<uint8_t> bytes(std::min(s_PageSize, m_PayloadBytes - offset));
+
+            m_Stream.clear();
+            m_Stream.seekg(static_cast<std::streamoff>(m_PayloadOffset + offset));
+            m_Stream.read(reinterpret_cast<char*>(bytes.data()),
+                          static_cast<std::streamsize>(bytes.size()));
+            if (!m_Stream) {
+                HERR("[MAZE_FILE]", " # Failed to read page {}...", page);
+                throw std::exception();
+            }
+
+            ++m_PageReads;
+            data = &m_Pages.put(page, std::move(bytes), s_PageSize);
+        }
+
+        // The most recent entry is never evicted until the next put
+        m_LastPage = page;
+        m_LastData = data;
+    }
+
+    //############################################################################//
+    // | DIRECTION STREAM |
+    //############################################################################//
+
+    DirectionStreamWriter::DirectionStreamWriter(
+            std::ostream& stream
+    ) : m_Stream(stream),
+        m_Buffer(),
+        m_Used(0),
+        m_Count(0) {
+    }
+
+    DirectionStreamReader::DirectionStreamReader(
+            std::istream& stream,
+            const uint64_t count
+    ) : m_Stream(stream),
+        m_Remaining(count),
+        m_Byte(0),
+        m_Slot(4) {
+    }
+
+    Cardinal DirectionStreamReader::next() {
+        if (m_Remaining == 0) {
+            HERR("[DIRECTION_STREAM]", " # Read past the last direction...");
+            throw std::exception();
+        }
+
+        if (m_Slot == 4) {
+            const auto byte = m_Stream.get();
+            if (!m_Stream) {
+                HERR("[DIRECTION_STREAM]", " # Stream ended with {} directions left...",
+                     m_Remaining);
+                throw std::exception();
+            }
+            m_Byte = static_cast<uint8_t>(byte);
+            m_Slot = 0;
+        }
+        --m_Remaining;
+        return static_cast<Cardinal>((m_Byte >> (2 * m_Slot++)) & 3U);
+    }
+
+} // maze
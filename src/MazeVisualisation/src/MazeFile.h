@@ -0,0 +1,463 @@
+//
+// Header File: MazeFile.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEFILE_H
+#define MAZEVISUALISATION_MAZEFILE_H
+
+#include "MazeConstructs.h"
+#include "MazeFrozen.h"
+#include "MazeView.h"
+#include "LruCache.h"
+
+#include <array>
+#include <fstream>
+#include <string>
+
+namespace maze {
+
+    //############################################################################//
+    // | MEMORY MAPPED FILE |
+    //############################################################################//
+
+    // Read only mapping of a whole file; POSIX mmap or a Win32 file mapping. Pages are only
+    // resident while the OS wants them, so mapping a file larger than RAM is fine.
+    class MappedFile {
+
+    public:
+        enum class Access {
+            NORMAL,
+            SEQUENTIAL,
+            RANDOM,
+            WILL_NEED
+        };
+
+    private:
+        const uint8_t* m_Data;
+        size_t         m_Size;
+#ifdef _WIN32
+        void*          m_File;
+        void*          m_Mapping;
+#else
+        int            m_File;
+#endif
+
+    public:
+        explicit MappedFile(const std::string& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator =(const MappedFile&) = delete;
+
+    public:
+        const uint8_t* data() const {
+            return m_Data;
+        }
+
+        size_t size() const {
+            return m_Size;
+        }
+
+        // Paging hint for the given byte range (madvise); a no-op where unsupported
+        void advise(Access access, size_t offset = 0, size_t length = SIZE_MAX) const;
+    };
+
+    //############################################################################//
+    // | MAZE FILE |
+    //############################################################################//
+
+    // Payload layouts, all row major:
+    //  NIBBLES - the four path bits of every cell, two cells per byte with the even cell in the
+    //            low nibble; bit i of a nibble is the opening towards Cardinal i (version 1).
+    //  CELLS   - the cells as Maze2D holds them (32 bit, little endian) so a mapping can be read
+    //            in place through a ConstMazeView. Colour flags are kept.
+    //  FROZEN  - the words of a FrozenMaze, 2 bits per cell.
+    // Solver state & costs are never stored.
+    enum class MazeLayout : uint32_t {
+        NIBBLES = 0,
+        CELLS   = 1,
+        FROZEN  = 2
+    };
+
+    // Version 2 header; the payload starts at 'payload_offset', a multiple of 64 bytes, so a
+    // mapping (page aligned) can hand out aligned pointers into it. Version 1 files, the first
+    // four fields followed by a NIBBLES payload, are still read.
+    struct MazeFileHeader {
+        uint32_t magic;
+        uint32_t version;
+        int32_t  rows;
+        int32_t  cols;
+        uint32_t layout;
+        uint32_t generator;
+        uint64_t seed;
+        uint64_t payload_offset;
+        uint64_t payload_bytes;
+        uint64_t reserved[2];
+    };
+    static_assert(sizeof(MazeFileHeader) == 64);
+
+    inline static constexpr uint32_t s_MazeFileMagic        = 0x455A414D; // "MAZE"
+    inline static constexpr uint32_t s_MazeFileVersion      = 2;
+    inline static constexpr size_t   s_MazeFileV1HeaderSize = 16;
+    inline static constexpr size_t   s_MazeFileAlignment    = 64;
+    inline static constexpr size_t   s_MazeFileWriteSize    = 1024 * 1024;
+    inline static constexpr uint32_t s_UnknownGenerator     = UINT32_MAX;
+
+    // Where a maze came from; 'generator' indexes s_MazeGeneratorFactories
+    struct MazeFileInfo {
+        uint32_t generator = s_UnknownGenerator;
+        uint64_t seed      = 0;
+    };
+
+    // The path bits of a cell as a nibble; bit i is set when the side towards Cardinal i is open
+    static constexpr uint8_t openings_of(const Cell cell) {
+        return static_cast<uint8_t>((cell >> 1) & 0xFU);
+    }
+
+    // Rows are streamed out in writes of up to 's_MazeFileWriteSize' bytes
+    void write_maze_file(
+            const Maze2D& maze,
+            const std::string& path,
+            MazeLayout layout = MazeLayout::CELLS,
+            const MazeFileInfo& info = {}
+    );
+
+    void write_maze_file(
+            const FrozenMazeView& maze,
+            const std::string& path,
+            const MazeFileInfo& info = {}
+    );
+
+    // Any layout or version
+    Maze2D read_maze_file(const std::string& path);
+
+    // Throws if the header is not a supported maze file or the payload is short; version 1
+    // headers are returned as the equivalent version 2 header
+    MazeFileHeader check_maze_file(const uint8_t* data, size_t size);
+
+    MazeFileHeader read_maze_file_header(const std::string& path);
+
+    // Version 2 header for a payload written straight after it
+    MazeFileHeader make_maze_file_header(
+            Index2D bounds,
+            MazeLayout layout,
+            const MazeFileInfo& info = {}
+    );
+
+    // Openings (a nibble as above) of one cell in any layout; 'byte_at(i)' reads payload byte i
+    template<class ByteAt>
+    uint8_t decode_openings(
+            const MazeLayout layout,
+            const Index2D pos,
+            const Index cols,
+            ByteAt&& byte_at
+    ) {
+        const size_t flat = static_cast<size_t>(pos.row) * cols + pos.col;
+        switch (layout) {
+            case MazeLayout::NIBBLES:
+                return (byte_at(flat >> 1) >> ((flat & 1) << 2)) & 0xFU;
+
+            // The path bits sit in the lowest byte
+            case MazeLayout::CELLS:
+                return openings_of(byte_at(flat * sizeof(Cell)));
+
+            case MazeLayout::FROZEN: {
+                const auto pair = [&](const size_t i) {
+                    return static_cast<uint8_t>((byte_at(i >> 2) >> ((i & 3) << 1)) & 3U);
+                };
+                auto openings = static_cast<uint8_t>(pair(flat) << 1);
+                if (pos.row > 0 && (pair(flat - cols) & 2U) != 0) openings |= 1U;
+                if (pos.col > 0 && (pair(flat - 1) & 1U) != 0) openings |= 8U;
+                return openings;
+            }
+        }
+        return 0;
+    }
+
+    //############################################################################//
+    // | MAZE FILE VIEWS |
+    //############################################################################//
+
+    // Both views answer 'get_openings(pos)' (a nibble as above) without loading the maze
+
+    // Zero copy view over a mapped maze file; opening one costs the same whatever its size. The
+    // payload can also be viewed as cells or frozen words when it has that layout.
+    class MappedMazeFile {
+
+    private:
+        MappedFile     m_File;
+        MazeFileHeader m_Header;
+        Index2D        m_Bounds;
+        MazeLayout     m_Layout;
+        const uint8_t* m_Payload;
+
+    public:
+        explicit MappedMazeFile(const std::string& path);
+
+    public:
+        Index2D get_bounds() const {
+            return m_Bounds;
+        }
+
+        MazeLayout get_layout() const {
+            return m_Layout;
+        }
+
+        const MazeFileHeader& get_header() const {
+            return m_Header;
+        }
+
+        uint8_t get_openings(const Index2D pos) const {
+            return decode_openings(m_Layout, pos, m_Bounds.col, [this](const size_t i) {
+                return m_Payload[i];
+            });
+        }
+
+        // CELLS layout only
+        ConstMazeView get_view() const;
+
+        // FROZEN layout only
+        FrozenMazeView get_frozen_view() const;
+
+        const MappedFile& get_file() const {
+            return m_File;
+        }
+
+        size_t get_state_bytes() const {
+            return sizeof(*this);
+        }
+
+    private:
+        void check_layout(MazeLayout layout) const;
+    };
+
+    // Reads fixed size pages on demand through a small LRU of pages; for when mapping is not
+    // available or the address space is the limit. Memory is bounded by the page budget.
+    class PagedMazeFile {
+
+    public:
+        inline static constexpr size_t s_PageSize      = 64 * 1024;
+        inline static constexpr size_t s_DefaultBudget = 16 * s_PageSize;
+
+        using PageCache = LruCache<size_t, std::vector<uint8_t>>;
+
+    private:
+        std::ifstream               m_Stream;
+        Index2D                     m_Bounds;
+        MazeLayout                  m_Layout;
+        size_t                      m_PayloadOffset;
+        size_t                      m_PayloadBytes;
+        PageCache                   m_Pages;
+        size_t                      m_LastPage;
+        const std::vector<uint8_t>* m_LastData;
+        size_t                      m_PageReads;
+
+    public:
+        explicit PagedMazeFile(const std::string& path, size_t budget = s_DefaultBudget);
+
+    public:
+        Index2D get_bounds() const {
+            return m_Bounds;
+        }
+
+        uint8_t get_openings(const Index2D pos) {
+            return decode_openings(m_Layout, pos, m_Bounds.col, [this](const size_t byte) {
+                const size_t page = byte / s_PageSize;
+                if (page != m_LastPage) load_page(page);
+                return (*m_LastData)[byte % s_PageSize];
+            });
+        }
+
+        size_t get_page_reads() const {
+            return m_PageReads;
+        }
+
+        size_t get_state_bytes() const {
+            return sizeof(*this) + m_Pages.get_total_cost();
+        }
+
+    private:
+        void load_page(size_t page);
+    };
+
+    //############################################################################//
+    // | DIRECTION STREAM |
+    //############################################################################//
+
+    // Moves packed at two bits each, four per byte (first move in the low bits), written through
+    // a fixed buffer so arbitrarily long walks take constant memory.
+    class DirectionStreamWriter {
+
+    public:
+        inline static constexpr size_t s_BufferSize = 4096;
+
+    private:
+        std::ostream&                     m_Stream;
+        std::array<uint8_t, s_BufferSize> m_Buffer;
+        size_t                            m_Used;
+        uint64_t                          m_Count;
+
+    public:
+        explicit DirectionStreamWriter(std::ostream& stream);
+
+    public:
+        void push(const Cardinal dir) {
+            const size_t slot = static_cast<size_t>(m_Count & 3);
+            if (slot == 0) {
+                if (m_Used == s_BufferSize) write_buffer();
+                m_Buffer[m_Used++] = 0;
+            }
+            m_Buffer[m_Used - 1] |= static_cast<uint8_t>(static_cast<uint8_t>(dir) << (slot * 2));
+            ++m_Count;
+        }
+
+        // Writes out the buffered bytes, the last possibly partial; call once after the last push
+        void finish() {
+            write_buffer();
+            m_Stream.flush();
+        }
+
+        uint64_t get_count() const {
+            return m_Count;
+        }
+
+        uint64_t get_byte_count() const {
+            return (m_Count + 3) / 4;
+        }
+
+    private:
+        void write_buffer() {
+            m_Stream.write(reinterpret_cast<const char*>(m_Buffer.data()),
+                           static_cast<std::streamsize>(m_Used));
+            m_Used = 0;
+        }
+    };
+
+    class DirectionStreamReader {
+
+    private:
+        std::istream& m_Stream;
+        uint64_t      m_Remaining;
+        uint8_t       m_Byte;
+        uint8_t       m_Slot;
+
+    public:
+        DirectionStreamReader(std::istream& stream, uint64_t count);
+
+    public:
+        bool empty() const {
+            return m_Remaining == 0;
+        }
+
+        // Throws once 'empty' or if the stream ends before 'count' directions were read
+        Cardinal next();
+    };
+
+    //############################################################################//
+    // | STREAMING WALL FOLLOWER |
+    //############################################################################//
+
+    // Right hand wall follower over any cell source with 'get_bounds()' & 'get_openings(pos)'
+    // (a Maze2D adapter or a maze file view) keeping only the position, heading & move count. The
+    // walk (dead ends included) is streamed out as directions. The hand rule is reversible so the
+    // walk is a cycle through the starting state; coming back to it without meeting the goal means
+    // the goal is not on this wall (only possible with loops) and the solve fails.
+    template<class Source>
+    class StreamingWallFollower {
+
+    private:
+        Source&  m_Source;
+        Index2D  m_Bounds;
+        Index2D  m_Pos;
+        Cardinal m_Heading;
+        uint64_t m_MoveCount;
+
+    public:
+        explicit StreamingWallFollower(
+                Source& source
+        ) : m_Source(source),
+            m_Bounds(source.get_bounds()),
+            m_Pos{ 0, 0 },
+            m_Heading(Cardinal::NORTH),
+            m_MoveCount(0) {
+        }
+
+    public:
+        bool solve(const Index2D start, const Index2D goal, DirectionStreamWriter& out) {
+            if (!start.inbounds(m_Bounds) || !goal.inbounds(m_Bounds)) {
+                HERR("[WALL_FOLLOWER]", " # Endpoints {} -> {} are out of bounds...",
+                     start.to_string(), goal.to_string());
+                throw std::exception();
+            }
+
+            m_Pos       = start;
+            m_Heading   = Cardinal::NORTH;
+            m_MoveCount = 0;
+
+            // Each (cell, heading) state appears at most once in the cycle
+            const uint64_t budget = static_cast<uint64_t>(m_Bounds.size()) * s_CardinalCount;
+            while (m_Pos != goal) {
+                if (!move()) return false;
+                out.push(m_Heading);
+
+                if (m_MoveCount > budget) return false;
+                if (m_Pos == start && m_Heading == Cardinal::NORTH) return false;
+            }
+            return true;
+        }
+
+        Index2D get_position() const {
+            return m_Pos;
+        }
+
+        uint64_t get_move_count() const {
+            return m_MoveCount;
+        }
+
+    private:
+        // Right, straight, left then back relative to the heading
+        bool move() {
+            const uint8_t openings = m_Source.get_openings(m_Pos);
+            const uint8_t heading  = static_cast<uint8_t>(m_Heading);
+
+            for (const uint8_t turn : { 1, 0, 3, 2 }) {
+                const Cardinal dir = static_cast<Cardinal>((heading + turn) & 3);
+                if ((openings & (1U << static_cast<uint8_t>(dir))) == 0) continue;
+
+                const Index2D next = m_Pos + cardinal_offset(dir);
+                if (!next.inbounds(m_Bounds)) continue;
+
+                m_Pos     = next;
+                m_Heading = dir;
+                ++m_MoveCount;
+                return true;
+            }
+            return false;
+        }
+    };
+
+    // Lets the wall follower run over an in memory maze
+    class MazeCellSource {
+
+    private:
+        const Maze2D& m_Maze;
+
+    public:
+        explicit MazeCellSource(const Maze2D& maze) : m_Maze(maze) {}
+
+    public:
+        Index2D get_bounds() const {
+            return m_Maze.get_bounds();
+        }
+
+        uint8_t get_openings(const Index2D pos) const {
+            return openings_of(m_Maze.get_cell_data()[pos.flat(m_Maze.get_col_count())]);
+        }
+    };
+
+} // maze
+
+#endif
@@ -0,0 +1,234 @@
+//
+// Header File: MazeFrozen.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeFrozen.h"
+#include "MazeFile.h"
+
+#include <fstream>
+
+namespace maze {
+
+    //############################################################################//
+    // | BIT KERNELS |
+    //############################################################################//
+
+    // Moves bit i of 'x' to bit 2i
+    static uint64_t spread_bits(const uint32_t x) {
+        uint64_t v = x;
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v << 2)) & 0x3333333333333333ULL;
+        v = (v | (v << 1)) & 0x5555555555555555ULL;
+        return v;
+    }
+
+    // Inverse of 'spread_bits'; odd bits are dropped
+    static uint32_t gather_bits(uint64_t v) {
+        v &= 0x5555555555555555ULL;
+        v = (v | (v >> 1)) & 0x3333333333333333ULL;
+        v = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v >> 4)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v >> 8)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v >> 16)) & 0x00000000FFFFFFFFULL;
+        return static_cast<uint32_t>(v);
+    }
+
+    // 'count' <= 64 bits starting at bit 'bit' of the word stream
+    static uint64_t read_bits(const uint64_t* words, size_t bit, size_t count) {
+        const size_t word  = bit / 64;
+        const size_t shift = bit % 64;
+
+        uint64_t value = words[word] >> shift;
+        if (shift != 0 && shift + count > 64) value |= words[word + 1] << (64 - shift);
+        return count == 64 ? value : value & ((uint64_t{ 1 } << count) - 1);
+    }
+
+    // ORs in 'count' <= 64 bits; the stream must be clear there
+    static void write_bits(std::vector<uint64_t>& words, size_t bit, size_t count, uint64_t value) {
+        const size_t word  = bit / 64;
+        const size_t shift = bit % 64;
+
+        words[word] |= value << shift;
+        if (shift != 0 && shift + count > 64) words[word + 1] |= value >> (64 - shift);
+    }
+
+    // Bit i is set when cells[i] has 'flag' set; count <= 32. Branch free so it vectorises.
+    static uint32_t open_mask(const Cell* cells, const Index count, const Cell flag) {
+        uint32_t mask = 0;
+        for (Index i = 0; i < count; ++i) {
+            mask |= static_cast<uint32_t>((cells[i] & flag) != 0) << i;
+        }
+        return mask;
+    }
+
+    //############################################################################//
+    // | FROZEN MAZE |
+    //############################################################################//
+
+    FrozenMaze::FrozenMaze(
+            const Maze2D& maze
+    ) : m_Bounds(maze.get_bounds()),
+        m_Words(FrozenMazeView::word_count(m_Bounds), 0) {
+
+        constexpr Cell north = cellof<Flag::PATH_NORTH>();
+        constexpr Cell east  = cellof<Flag::PATH_EAST>();
+        constexpr Cell south = cellof<Flag::PATH_SOUTH>();
+        constexpr Cell west  = cellof<Flag::PATH_WEST>();
+        constexpr auto chunk = static_cast<Index>(FrozenMazeView::s_CellsPerWord);
+
+        const Cell* data = maze.get_cell_data();
+        const Index rows = m_Bounds.row;
+        const Index cols = m_Bounds.col;
+
+        // A side is kept open only when the cell across agrees
+        for (Index row = 0; row < rows; ++row) {
+            const Cell* line  = data + static_cast<size_t>(row) * cols;
+            const Cell* below = row + 1 < rows ? line + cols : nullptr;
+
+            for (Index col = 0; col < cols; col += chunk) {
+                const Index count = std::min(chunk, cols - col);
+
+                // West side of the first cell in the next chunk, none past the last column
+                const uint32_t next_west = col + count < cols && (line[col + count] & west) != 0;
+                const uint32_t west_mask = (open_mask(line + col, count, west) >> 1)
+                                           | (next_west << (count - 1));
+                const uint32_t east_mask = open_mask(line + col, count, east) & west_mask;
+
+                uint32_t south_mask = 0;
+                if (below != nullptr) {
+                    south_mask = open_mask(line + col, count, south)
+                                 & open_mask(below + col, count, north);
+                }
+
+                const size_t flat = static_cast<size_t>(row) * cols + col;
+                write_bits(m_Words, flat * 2, static_cast<size_t>(count) * 2,
+                           spread_bits(east_mask) | (spread_bits(south_mask) << 1));
+            }
+        }
+    }
+
+    FrozenMaze::FrozenMaze(
+            const Index2D bounds,
+            std::vector<uint64_t> words
+    ) : m_Bounds(bounds),
+        m_Words(std::move(words)) {
+
+        const bool is_empty = bounds.row <= 0 || bounds.col <= 0;
+        if (is_empty || m_Words.size() != FrozenMazeView::word_count(bounds)) {
+            HERR("[FROZEN_MAZE]", " # {} words do not fit a maze of '{}'...",
+                 m_Words.size(), bounds.to_string());
+            throw std::exception();
+        }
+    }
+
+    Maze2D FrozenMazeView::thaw() const {
+        constexpr auto chunk = static_cast<Index>(s_CellsPerWord);
+        const Index    rows  = m_Bounds.row;
+        const Index    cols  = m_Bounds.col;
+
+        Maze2D maze{ rows, cols };
+        auto   out = maze.begin();
+
+        for (Index row = 0; row < rows; ++row) {
+            // East side of the cell to the left of the chunk
+            uint32_t carry = 0;
+
+            for (Index col = 0; col < cols; col += chunk) {
+                const Index  count = std::min(chunk, cols - col);
+                const size_t flat  = static_cast<size_t>(row) * cols + col;
+                const size_t bits  = static_cast<size_t>(count) * 2;
+
+                const uint64_t pairs = read_bits(m_Words, flat * 2, bits);
+                const uint32_t east  = gather_bits(pairs);
+                const uint32_t south = gather_bits(pairs >> 1);
+                const uint32_t west  = (east << 1) | carry;
+
+                uint32_t north = 0;
+                if (row > 0) north = gather_bits(read_bits(m_Words, (flat - cols) * 2, bits) >> 1);
+                carry = (east >> (count - 1)) & 1U;
+
+                // Openings are PATH_NORTH .. PATH_WEST shifted down by one
+                for (Index i = 0; i < count; ++i, ++out) {
+                    const uint32_t openings = ((north >> i) & 1U)
+                                              | (((east >> i) & 1U) << 1)
+                                              | (((south >> i) & 1U) << 2)
+                                              | (((west >> i) & 1U) << 3);
+                    *out = openings == 0
+                           ? cellof<Flag::EMPTY_PATH>()
+                           : static_cast<Cell>(openings) << 1;
+                }
+            }
+        }
+
+        maze.rehash();
+        return maze;
+    }
+
+    //############################################################################//
+    // | FROZEN MAZE FILE |
+    //############################################################################//
+
+    // Words are copied out of a FROZEN maze file, anything else is read & frozen
+    static FrozenMaze read_frozen_maze_file(const std::string& path) {
+        const MappedMazeFile file{ path };
+        if (file.get_layout() != MazeLayout::FROZEN) return FrozenMaze{ read_maze_file(path) };
+
+        const FrozenMazeView  view  = file.get_frozen_view();
+        const uint64_t*       words = view.get_words();
+        std::vector<uint64_t> copy(words, words + FrozenMazeView::word_count(view.get_bounds()));
+        return FrozenMaze{ view.get_bounds(), std::move(copy) };
+    }
+
+    void write_frozen_maze(const FrozenMaze& maze, const std::string& path) {
+        write_maze_file(maze.get_view(), path);
+    }
+
+    FrozenMaze read_frozen_maze(const std::string& path) {
+        std::ifstream stream{ path, std::ios::binary | std::ios::ate };
+        if (!stream) {
+            HERR("[FROZEN_MAZE]", " # Failed to open '{}'...", path);
+            throw std::exception();
+        }
+
+        const auto       file_size = static_cast<size_t>(stream.tellg());
+        FrozenMazeHeader header{};
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(&header), sizeof(FrozenMazeHeader));
+
+        // Anything but a stand-alone frozen file must be a maze file
+        if (!stream || header.magic != s_FrozenMazeMagic) {
+            stream.close();
+            return read_frozen_maze_file(path);
+        }
+
+        if (header.version != s_FrozenMazeVersion) {
+            HERR("[FROZEN_MAZE]", " # '{}' has unsupported frozen maze version {}",
+                 path, header.version);
+            throw std::exception();
+        }
+
+        const Index2D bounds{ header.rows, header.cols };
+        const bool    is_empty = bounds.row <= 0 || bounds.col <= 0;
+        const size_t  count    = is_empty ? 0 : FrozenMazeView::word_count(bounds);
+        if (count == 0 || file_size < sizeof(FrozenMazeHeader) + count * sizeof(uint64_t)) {
+            HERR("[FROZEN_MAZE]", " # Frozen maze of {} x {} is truncated or invalid ({} bytes)...",
+                 header.rows, header.cols, file_size);
+            throw std::exception();
+        }
+
+        std::vector<uint64_t> words(count);
+        stream.read(reinterpret_cast<char*>(words.data()),
+                    static_cast<std::streamsize>(count * sizeof(uint64_t)));
+        if (!stream) {
+            HERR("[FROZEN_MAZE]", " # Failed reading '{}'...", path);
+            throw std::exception();
+        }
+        return FrozenMaze{ bounds, std::move(words) };
+    }
+
+} // maze
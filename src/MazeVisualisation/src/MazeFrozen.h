@@ -0,0 +1,243 @@
+//
+// Header File: MazeFrozen.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEFROZEN_H
+#define MAZEVISUALISATION_MAZEFROZEN_H
+
+#include "MazeConstructs.h"
+
+#include <string>
+
+namespace maze {
+
+    //############################################################################//
+    // | FROZEN MAZE |
+    //############################################################################//
+
+    // Read only copy of a finished maze keeping two bits per cell, whether its east & south sides
+    // are open, packed 32 cells to a 64 bit word in flat (row major) order: cell 'i' sits at bits
+    // 2i (east) & 2i + 1 (south) of the stream. North & west are read from the neighbour above &
+    // to the left, and the outer sides are always walls. At 2 bits instead of 32 a frozen maze is
+    // 16 times smaller than its Maze2D.
+    //
+    // The view does not own the words so it can sit over a FrozenMaze or a mapped maze file.
+    class FrozenMazeView {
+
+    public:
+        inline static constexpr size_t   s_CellsPerWord = 32;
+        inline static constexpr uint64_t s_EastBit      = 1;
+        inline static constexpr uint64_t s_SouthBit     = 2;
+
+    private:
+        Index2D         m_Bounds;
+        const uint64_t* m_Words;
+
+    public:
+        // 'words' must hold 'word_count(bounds)' entries & outlive the view
+        FrozenMazeView(
+                const Index2D bounds,
+                const uint64_t* words
+        ) : m_Bounds(bounds),
+            m_Words(words) {
+        }
+
+    public:
+        // Back to full cells a row chunk at a time; colours, costs & solver state are not kept
+        Maze2D thaw() const;
+
+        //############################################################################//
+        // | GETTERS |
+        //############################################################################//
+
+    public:
+        Index2D get_bounds() const {
+            return m_Bounds;
+        }
+
+        Index get_row_count() const {
+            return m_Bounds.row;
+        }
+
+        Index get_col_count() const {
+            return m_Bounds.col;
+        }
+
+        size_t get_size() const {
+            return m_Bounds.size();
+        }
+
+        bool inbounds(const Index2D pos) const {
+            return pos.inbounds(m_Bounds);
+        }
+
+        const uint64_t* get_words() const {
+            return m_Words;
+        }
+
+        static size_t word_count(const Index2D bounds) {
+            return (bounds.size() + s_CellsPerWord - 1) / s_CellsPerWord;
+        }
+
+        bool is_wall(const Index2D pos, const Cardinal dir) const {
+            check_index(pos);
+            const size_t flat = static_cast<size_t>(pos.row) * m_Bounds.col + pos.col;
+            switch (dir) {
+                case Cardinal::NORTH:
+                    return pos.row == 0 || !is_open(flat - m_Bounds.col, s_SouthBit);
+                case Cardinal::EAST:
+                    return !is_open(flat, s_EastBit);
+                case Cardinal::SOUTH:
+                    return !is_open(flat, s_SouthBit);
+                case Cardinal::WEST:
+                    return pos.col == 0 || !is_open(flat - 1, s_EastBit);
+            }
+            return true;
+        }
+
+        // Neighbour mask; bit 'i' is set when the side towards Cardinal 'i' is open, the same
+        // layout as 'openings_of' so a frozen maze can feed the streaming solvers. Unchecked.
+        uint8_t get_openings(const Index2D pos) const {
+            const size_t flat = static_cast<size_t>(pos.row) * m_Bounds.col + pos.col;
+            const size_t cols = static_cast<size_t>(m_Bounds.col);
+
+            // East & south land on bits 1 & 2 as they are
+            auto openings = static_cast<uint8_t>(pair_at(flat) << 1);
+            if (pos.row > 0 && is_open(flat - cols, s_SouthBit)) openings |= 1U;
+            if (pos.col > 0 && is_open(flat - 1, s_EastBit)) openings |= 8U;
+            return openings;
+        }
+
+        // fn(Index2D, uint8_t openings) in flat order
+        template<class Function>
+        void for_each_cell(Function fn) const {
+            for (Index row = 0; row < m_Bounds.row; ++row) {
+                for (Index col = 0; col < m_Bounds.col; ++col) {
+                    const Index2D pos{ row, col };
+                    fn(pos, get_openings(pos));
+                }
+            }
+        }
+
+        // fn(Cardinal, Index2D) for the walls Maze2D::for_each_wall_unique would report
+        template<class Function>
+        void for_each_wall_unique(Function fn) const {
+            size_t flat = 0;
+            for (Index row = 0; row < m_Bounds.row; ++row) {
+                for (Index col = 0; col < m_Bounds.col; ++col, ++flat) {
+                    const Index2D  pos{ row, col };
+                    const uint64_t bits = pair_at(flat);
+                    if (row == 0) fn(Cardinal::NORTH, pos);
+                    if (col == 0) fn(Cardinal::WEST, pos);
+                    if ((bits & s_EastBit) == 0) fn(Cardinal::EAST, pos);
+                    if ((bits & s_SouthBit) == 0) fn(Cardinal::SOUTH, pos);
+                }
+            }
+        }
+
+        //############################################################################//
+        // | UTILITY |
+        //############################################################################//
+
+    private:
+        uint64_t pair_at(const size_t flat) const {
+            return (m_Words[flat / s_CellsPerWord] >> ((flat % s_CellsPerWord) * 2)) & 3U;
+        }
+
+        bool is_open(const size_t flat, const uint64_t bit) const {
+            return (pair_at(flat) & bit) != 0;
+        }
+
+        void check_index(const Index2D pos) const {
+            if (!inbounds(pos)) {
+                HERR("[FROZEN_MAZE]", " # Index '{}' is out of bounds for '{}'...",
+                     pos.to_string(), m_Bounds.to_string());
+                throw std::exception();
+            }
+        }
+    };
+
+    // Owning frozen maze; queries go through its view. Only passages both cells agree on survive
+    // freezing, so thawing gives back the walls of any consistent maze (every generated one).
+    class FrozenMaze {
+
+    private:
+        Index2D               m_Bounds;
+        std::vector<uint64_t> m_Words;
+
+    public:
+        FrozenMaze() : m_Bounds{ 0, 0 }, m_Words() {}
+
+        // One pass over the cells a row chunk at a time
+        explicit FrozenMaze(const Maze2D& maze);
+
+        // Adopts already packed words; 'words' must hold 'word_count(bounds)' entries
+        FrozenMaze(Index2D bounds, std::vector<uint64_t> words);
+
+    public:
+        FrozenMazeView get_view() const {
+            return FrozenMazeView{ m_Bounds, m_Words.data() };
+        }
+
+        Maze2D thaw() const {
+            return get_view().thaw();
+        }
+
+        Index2D get_bounds() const {
+            return m_Bounds;
+        }
+
+        Index get_row_count() const {
+            return m_Bounds.row;
+        }
+
+        Index get_col_count() const {
+            return m_Bounds.col;
+        }
+
+        const std::vector<uint64_t>& get_words() const {
+            return m_Words;
+        }
+
+        size_t get_state_bytes() const {
+            return m_Words.capacity() * sizeof(uint64_t);
+        }
+
+        bool is_wall(const Index2D pos, const Cardinal dir) const {
+            return get_view().is_wall(pos, dir);
+        }
+
+        uint8_t get_openings(const Index2D pos) const {
+            return get_view().get_openings(pos);
+        }
+    };
+
+    //############################################################################//
+    // | FROZEN MAZE FILE |
+    //############################################################################//
+
+    inline static constexpr uint32_t s_FrozenMazeMagic   = 0x4E5A5246; // "FRZN"
+    inline static constexpr uint32_t s_FrozenMazeVersion = 1;
+
+    // Stand-alone frozen file; the header is followed by the packed words as they are held in
+    // memory (little endian). Still read, but frozen mazes are now written as maze files.
+    struct FrozenMazeHeader {
+        uint32_t magic;
+        uint32_t version;
+        int32_t  rows;
+        int32_t  cols;
+    };
+
+    // A maze file with the FROZEN layout (see MazeFile.h)
+    void write_frozen_maze(const FrozenMaze& maze, const std::string& path);
+
+    // A stand-alone frozen file or any maze file; frozen words are read straight into the maze's
+    // storage and any other layout is frozen after reading
+    FrozenMaze read_frozen_maze(const std::string& path);
+
+} // maze
+
+#endif
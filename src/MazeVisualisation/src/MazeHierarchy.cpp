@@ -0,0 +1,391 @@
+//
+// Header File: MazeHierarchy.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeHierarchy.h"
+
+namespace maze {
+
+    HierarchicalPathfinder::HierarchicalPathfinder(
+            Index cluster_size
+    ) : m_ClusterSize(cluster_size),
+        m_Bounds{ 0, 0 },
+        m_ClusterBounds{ 0, 0 },
+        m_Clusters(),
+        m_NodeCells(),
+        m_NodeSlots(),
+        m_Crossings(),
+        m_NodeOf(),
+        m_Distances(),
+        m_Parents(),
+        m_Touched(),
+        m_Open(),
+        m_StartSearch(),
+        m_GoalSearch(),
+        m_RefineSearch(),
+        m_ExpandedCount(0),
+        m_RefinedCount(0) {
+
+        if (m_ClusterSize <= 0 || m_ClusterSize > s_MaxClusterSize) {
+            HERR("[HPA]", " # Cluster size must be in [1, {}]; got {}",
+                 s_MaxClusterSize, m_ClusterSize);
+            throw std::exception();
+        }
+    }
+
+    //############################################################################//
+    // | CONSTRUCTION |
+    //############################################################################//
+
+    void HierarchicalPathfinder::build(const Maze2D& maze) {
+        m_Bounds        = maze.get_bounds();
+        m_ClusterBounds = Index2D{
+                (m_Bounds.row + m_ClusterSize - 1) / m_ClusterSize,
+                (m_Bounds.col + m_ClusterSize - 1) / m_ClusterSize
+        };
+
+        m_Clusters.assign(m_ClusterBounds.size(), Cluster{});
+        m_NodeCells.clear();
+        m_NodeSlots.clear();
+        m_Crossings.clear();
+        m_NodeOf.clear();
+        m_Distances.clear();
+
+        // Node ids are handed out serially; the expensive part is the per cluster searches
+        for (size_t cluster = 0; cluster < m_Clusters.size(); ++cluster) {
+            scan_entrances(maze, cluster);
+        }
+
+        ThreadPool::get_shared().parallel_for(m_Clusters.size(), [&](size_t begin, size_t end) {
+            thread_local LocalSearch search{};
+            for (size_t cluster = begin; cluster < end; ++cluster) {
+                compute_distances(maze, cluster, search);
+            }
+        });
+
+        HINFO("[HPA]", " # Clusters: {}, Entrances: {}", m_Clusters.size(), m_NodeCells.size());
+    }
+
+    void HierarchicalPathfinder::update(const Maze2D& maze, const Index2D pos, const Cardinal dir) {
+        const size_t first  = cluster_of(pos.flat(m_Bounds.col));
+        const size_t second = cluster_of((pos + cardinal_offset(dir)).flat(m_Bounds.col));
+
+        scan_entrances(maze, first);
+        if (second != first) scan_entrances(maze, second);
+
+        compute_distances(maze, first, m_RefineSearch);
+        if (second != first) compute_distances(maze, second, m_RefineSearch);
+    }
+
+    void HierarchicalPathfinder::scan_entrances(const Maze2D& maze, const size_t cluster) {
+        const Index row_begin = static_cast<Index>(cluster) / m_ClusterBounds.col * m_ClusterSize;
+        const Index col_begin = static_cast<Index>(cluster) % m_ClusterBounds.col * m_ClusterSize;
+        const Index row_end   = std::min(row_begin + m_ClusterSize, m_Bounds.row);
+        const Index col_end   = std::min(col_begin + m_ClusterSize, m_Bounds.col);
+
+        std::vector<uint32_t>& nodes = m_Clusters[cluster].nodes;
+        nodes.clear();
+
+        const auto visit = [&](const Index row, const Index col) {
+            const Index2D pos{ row, col };
+            for (const Cardinal dir : s_AllCardinals) {
+                const Index2D next = pos + cardinal_offset(dir);
+                if (!maze.inbounds(next) || is_wall(dir, maze.get_cell(pos))) continue;
+                if (next.row >= row_begin && next.row < row_end
+                    && next.col >= col_begin && next.col < col_end) {
+                    continue;
+                }
+
+                const uint32_t node    = ensure_node(pos.flat(m_Bounds.col));
+                const uint32_t partner = ensure_node(next.flat(m_Bounds.col));
+                m_Crossings[node][static_cast<size_t>(dir)] = partner;
+
+                if (nodes.empty() || nodes.back() != node) {
+                    m_NodeSlots[node] = static_cast<uint32_t>(nodes.size());
+                    nodes.push_back(node);
+                }
+            }
+        };
+
+        // Border cells only, each visited once
+        for (Index row = row_begin; row < row_end; ++row) {
+            if (row == row_begin || row == row_end - 1) {
+                for (Index col = col_begin; col < col_end; ++col) visit(row, col);
+            } else {
+                visit(row, col_begin);
+                if (col_end - 1 != col_begin) visit(row, col_end - 1);
+            }
+        }
+    }
+
+    void HierarchicalPathfinder::compute_distances(
+            const Maze2D& maze,
+            const size_t cluster,
+            LocalSearch& search
+    ) {
+        Cluster&     data  = m_Clusters[cluster];
+        const size_t count = data.nodes.size();
+        data.distances.assign(count * count, s_NoPath);
+
+        for (size_t i = 0; i < count; ++i) {
+            search_cluster(maze, cluster, m_NodeCells[data.nodes[i]], search);
+            for (size_t j = 0; j < count; ++j) {
+                const Index    local    = local_of(cluster, m_NodeCells[data.nodes[j]]);
+                const uint32_t distance = search.distances[local];
+                if (distance != s_Unreachable) {
+                    data.distances[i * count + j] = static_cast<uint16_t>(distance);
+                }
+            }
+        }
+    }
+
+    //############################################################################//
+    // | QUERIES |
+    //############################################################################//
+
+    std::vector<Index> HierarchicalPathfinder::find_path(
+            const Maze2D& maze,
+            const Index2D start,
+            const Index2D goal
+    ) {
+        maze.check_index(start);
+        maze.check_index(goal);
+        reset_query();
+
+        const uint32_t start_node    = static_cast<uint32_t>(m_NodeCells.size());
+        const uint32_t goal_node     = start_node + 1;
+        const Index    from          = start.flat(m_Bounds.col);
+        const Index    to            = goal.flat(m_Bounds.col);
+        const size_t   start_cluster = cluster_of(from);
+        const size_t   goal_cluster  = cluster_of(to);
+
+        const auto estimate = [&](const uint32_t node) {
+            const Index cell = m_NodeCells[node];
+            return ManhattanHeuristic::estimate(
+                    Index2D{ cell / m_Bounds.col, cell % m_Bounds.col }, goal
+            );
+        };
+
+        // The endpoints are connected to the entrances of their own cluster
+        search_cluster(maze, start_cluster, from, m_StartSearch);
+        search_cluster(maze, goal_cluster, to, m_GoalSearch);
+
+        uint32_t best      = s_Unreachable;
+        bool     is_direct = false;
+        if (start_cluster == goal_cluster) {
+            best      = m_StartSearch.distances[local_of(start_cluster, to)];
+            is_direct = best != s_Unreachable;
+        }
+
+        relax(start_node, 0, s_NoNode, ManhattanHeuristic::estimate(start, goal));
+        while (!m_Open.empty() && m_Open.top_key() < best) {
+            const uint32_t node     = static_cast<uint32_t>(m_Open.pop());
+            const uint32_t distance = m_Distances[node];
+            ++m_ExpandedCount;
+
+            if (node == goal_node) {
+                best      = distance;
+                is_direct = false;
+                break;
+            }
+
+            if (node == start_node) {
+                for (const uint32_t entrance : m_Clusters[start_cluster].nodes) {
+                    const Index    local = local_of(start_cluster, m_NodeCells[entrance]);
+                    const uint32_t cost  = m_StartSearch.distances[local];
+                    if (cost != s_Unreachable) relax(entrance, cost, node, estimate(entrance));
+                }
+                continue;
+            }
+
+            const size_t   cluster = cluster_of(m_NodeCells[node]);
+            const Cluster& data    = m_Clusters[cluster];
+            const size_t   count   = data.nodes.size();
+            const size_t   row     = m_NodeSlots[node] * count;
+
+            for (size_t i = 0; i < count; ++i) {
+                const uint16_t cost = data.distances[row + i];
+                if (cost == s_NoPath) continue;
+                relax(data.nodes[i], distance + cost, node, estimate(data.nodes[i]));
+            }
+
+            for (const uint32_t partner : m_Crossings[node]) {
+                if (partner != s_NoNode) relax(partner, distance + 1, node, estimate(partner));
+            }
+
+            if (cluster == goal_cluster) {
+                const uint32_t cost = m_GoalSearch.distances[local_of(cluster, m_NodeCells[node])];
+                if (cost != s_Unreachable) relax(goal_node, distance + cost, node, 0);
+            }
+        }
+
+        std::vector<Index> path{};
+        if (best == s_Unreachable) return path;
+
+        path.reserve(best + 1);
+        path.push_back(from);
+        if (is_direct) {
+            append_local_path(maze, start_cluster, from, to, path);
+            return path;
+        }
+
+        // Refine the abstract path; crossings are single steps, the rest are cluster searches
+        std::vector<uint32_t> chain{};
+        for (uint32_t node = goal_node; node != s_NoNode; node = m_Parents[node]) {
+            chain.push_back(node);
+        }
+        std::reverse(chain.begin(), chain.end());
+
+        for (size_t i = 1; i < chain.size(); ++i) {
+            const Index prev = chain[i - 1] == start_node ? from : m_NodeCells[chain[i - 1]];
+            const Index next = chain[i] == goal_node ? to : m_NodeCells[chain[i]];
+            if (prev == next) continue;
+
+            const size_t cluster = cluster_of(prev);
+            if (cluster == cluster_of(next)) {
+                append_local_path(maze, cluster, prev, next, path);
+            } else {
+                path.push_back(next);
+            }
+        }
+        return path;
+    }
+
+    //############################################################################//
+    // | CLUSTER SEARCH |
+    //############################################################################//
+
+    size_t HierarchicalPathfinder::cluster_of(const Index flat) const {
+        const Index row = flat / m_Bounds.col;
+        const Index col = flat % m_Bounds.col;
+        return static_cast<size_t>(
+                (row / m_ClusterSize) * m_ClusterBounds.col + (col / m_ClusterSize)
+        );
+    }
+
+    Index HierarchicalPathfinder::local_of(const size_t cluster, const Index flat) const {
+        const Index row_begin = static_cast<Index>(cluster) / m_ClusterBounds.col * m_ClusterSize;
+        const Index col_begin = static_cast<Index>(cluster) % m_ClusterBounds.col * m_ClusterSize;
+        return (flat / m_Bounds.col - row_begin) * m_ClusterSize
+               + (flat % m_Bounds.col - col_begin);
+    }
+
+    uint32_t HierarchicalPathfinder::ensure_node(const Index flat) {
+        const uint32_t next     = static_cast<uint32_t>(m_NodeCells.size());
+        const auto [it, is_new] = m_NodeOf.try_emplace(flat, next);
+        if (is_new) {
+            m_NodeCells.push_back(flat);
+            m_NodeSlots.push_back(0);
+            m_Crossings.push_back(Crossings{ s_NoNode, s_NoNode, s_NoNode, s_NoNode });
+        }
+        return it->second;
+    }
+
+    void HierarchicalPathfinder::search_cluster(
+            const Maze2D& maze,
+            const size_t cluster,
+            const Index source,
+            LocalSearch& search
+    ) const {
+        const Index row_begin = static_cast<Index>(cluster) / m_ClusterBounds.col * m_ClusterSize;
+        const Index col_begin = static_cast<Index>(cluster) % m_ClusterBounds.col * m_ClusterSize;
+        const Index row_end   = std::min(row_begin + m_ClusterSize, m_Bounds.row);
+        const Index col_end   = std::min(col_begin + m_ClusterSize, m_Bounds.col);
+        const Index cols      = m_Bounds.col;
+
+        search.distances.assign(static_cast<size_t>(m_ClusterSize) * m_ClusterSize, s_Unreachable);
+        search.parents.resize(search.distances.size());
+        search.queue.clear();
+
+        search.distances[local_of(cluster, source)] = 0;
+        search.queue.push_back(source);
+
+        for (size_t head = 0; head < search.queue.size(); ++head) {
+            const Index    pos      = search.queue[head];
+            const uint32_t distance = search.distances[local_of(cluster, pos)];
+
+            for_each_open(maze, pos, [&](const Cardinal dir, const Index next) {
+                const Index row = next / cols;
+                const Index col = next % cols;
+                if (row < row_begin || row >= row_end || col < col_begin || col >= col_end) return;
+
+                const Index local = local_of(cluster, next);
+                if (search.distances[local] != s_Unreachable) return;
+
+                search.distances[local] = distance + 1;
+                search.parents[local]   = opposite(dir);
+                search.queue.push_back(next);
+            });
+        }
+    }
+
+    void HierarchicalPathfinder::append_local_path(
+            const Maze2D& maze,
+            const size_t cluster,
+            const Index from,
+            const Index to,
+            std::vector<Index>& path
+    ) {
+        search_cluster(maze, cluster, from, m_RefineSearch);
+        ++m_RefinedCount;
+
+        const size_t offset = path.size();
+        for (Index pos = to; pos != from;) {
+            path.push_back(pos);
+            pos += flat_offset(m_RefineSearch.parents[local_of(cluster, pos)], m_Bounds.col);
+        }
+        std::reverse(path.begin() + static_cast<std::ptrdiff_t>(offset), path.end());
+    }
+
+    void HierarchicalPathfinder::reset_query() {
+        const size_t nodes = m_NodeCells.size() + 2;
+        m_ExpandedCount = 0;
+        m_RefinedCount  = 0;
+
+        if (m_Distances.size() != nodes) {
+            m_Distances.assign(nodes, s_Unreachable);
+            m_Parents.assign(nodes, s_NoNode);
+            m_Open.resize(nodes);
+            m_Touched.clear();
+            return;
+        }
+
+        for (const uint32_t node : m_Touched) m_Distances[node] = s_Unreachable;
+        m_Touched.clear();
+        m_Open.clear();
+    }
+
+    void HierarchicalPathfinder::relax(
+            const uint32_t node,
+            const uint32_t distance,
+            const uint32_t parent,
+            const uint32_t estimate
+    ) {
+        if (distance >= m_Distances[node]) return;
+        if (m_Distances[node] == s_Unreachable) m_Touched.push_back(node);
+
+        m_Distances[node] = distance;
+        m_Parents[node]   = parent;
+        m_Open.push_or_decrease(static_cast<Index>(node), distance + estimate);
+    }
+
+    size_t HierarchicalPathfinder::get_state_bytes() const {
+        size_t clusters = 0;
+        for (const Cluster& cluster : m_Clusters) {
+            clusters += cluster.nodes.capacity() * sizeof(uint32_t)
+                        + cluster.distances.capacity() * sizeof(uint16_t);
+        }
+
+        return clusters
+               + m_NodeCells.capacity() * sizeof(Index)
+               + m_NodeSlots.capacity() * sizeof(uint32_t)
+               + m_Crossings.capacity() * sizeof(Crossings)
+               + m_NodeOf.size() * (sizeof(Index) + sizeof(uint32_t))
+               + (m_Distances.capacity() + m_Parents.capacity()) * sizeof(uint32_t)
+               + m_Open.get_bytes();
+    }
+
+} // maze
@@ -0,0 +1,137 @@
+//
+// Header File: MazeHierarchy.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEHIERARCHY_H
+#define MAZEVISUALISATION_MAZEHIERARCHY_H
+
+#include "MazeConstructs.h"
+#include "MazeParallel.h"
+#include "MazeSolvers.h"
+
+#include <array>
+#include <unordered_map>
+
+namespace maze {
+
+    //############################################################################//
+    // | HIERARCHICAL PATHFINDING (HPA*) |
+    //############################################################################//
+
+    // Splits the maze into square clusters; every open wall between two clusters makes an
+    // entrance on both sides. Distances between the entrances of a cluster are precomputed (in
+    // parallel per cluster) so a query is an A* over the small abstract graph followed by a
+    // refinement which only searches the clusters along the abstract path. Every border opening
+    // is its own entrance (maze corridors are one cell wide) so the abstract distances are exact.
+    class HierarchicalPathfinder {
+
+    public:
+        inline static constexpr Index    s_DefaultClusterSize = 32;
+        inline static constexpr uint32_t s_NoNode             = UINT32_MAX;
+        inline static constexpr uint32_t s_Unreachable        = UINT32_MAX;
+        inline static constexpr uint16_t s_NoPath             = UINT16_MAX;
+
+        // Entrance distances are 16 bit; a path inside a cluster is shorter than its cell count
+        inline static constexpr Index    s_MaxClusterSize     = 255;
+
+    private:
+        struct Cluster {
+            std::vector<uint32_t> nodes;
+            std::vector<uint16_t> distances;
+        };
+
+        // Cluster local BFS buffers; distances & parent directions by local index
+        struct LocalSearch {
+            std::vector<uint32_t> distances;
+            std::vector<Cardinal> parents;
+            std::vector<Index>    queue;
+        };
+
+        // Node across the border in each direction (s_NoNode if closed)
+        using Crossings = std::array<uint32_t, s_CardinalCount>;
+
+    private:
+        Index                               m_ClusterSize;
+        Index2D                             m_Bounds;
+        Index2D                             m_ClusterBounds;
+        std::vector<Cluster>                m_Clusters;
+        std::vector<Index>                  m_NodeCells;
+        std::vector<uint32_t>               m_NodeSlots;
+        std::vector<Crossings>              m_Crossings;
+        std::unordered_map<Index, uint32_t> m_NodeOf;
+
+        // Query State; the start & goal are two extra nodes after the entrances
+        std::vector<uint32_t>               m_Distances;
+        std::vector<uint32_t>               m_Parents;
+        std::vector<uint32_t>               m_Touched;
+        IndexedMinHeap<4>                   m_Open;
+        LocalSearch                         m_StartSearch;
+        LocalSearch                         m_GoalSearch;
+        LocalSearch                         m_RefineSearch;
+        size_t                              m_ExpandedCount;
+        size_t                              m_RefinedCount;
+
+    public:
+        explicit HierarchicalPathfinder(Index cluster_size = s_DefaultClusterSize);
+
+    public:
+        void build(const Maze2D& maze);
+
+        // Rebuilds the cluster(s) either side of a wall opened by 'maze.make_path(pos, dir)'
+        void update(const Maze2D& maze, Index2D pos, Cardinal dir);
+
+        // Flat cells from start to goal (inclusive); empty if unreachable
+        std::vector<Index> find_path(const Maze2D& maze, Index2D start, Index2D goal);
+
+    public:
+        size_t get_cluster_count() const {
+            return m_Clusters.size();
+        }
+
+        size_t get_node_count() const {
+            return m_NodeCells.size();
+        }
+
+        // Abstract nodes expanded by the last query
+        size_t get_expanded_count() const {
+            return m_ExpandedCount;
+        }
+
+        // Cluster searches made while refining the last query
+        size_t get_refined_count() const {
+            return m_RefinedCount;
+        }
+
+        size_t get_state_bytes() const;
+
+    private:
+        size_t cluster_of(Index flat) const;
+        Index local_of(size_t cluster, Index flat) const;
+        uint32_t ensure_node(Index flat);
+
+        void scan_entrances(const Maze2D& maze, size_t cluster);
+        void compute_distances(const Maze2D& maze, size_t cluster, LocalSearch& search);
+        void search_cluster(
+                const Maze2D& maze,
+                size_t cluster,
+                Index source,
+                LocalSearch& search
+        ) const;
+        void append_local_path(
+                const Maze2D& maze,
+                size_t cluster,
+                Index from,
+                Index to,
+                std::vector<Index>& path
+        );
+
+        void reset_query();
+        void relax(uint32_t node, uint32_t distance, uint32_t parent, uint32_t estimate);
+    };
+
+} // maze
+
+#endif
@@ -0,0 +1,380 @@
+//
+// Header File: MazeJunctionGraph.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeJunctionGraph.h"
+
+namespace maze {
+
+    JunctionGraph::JunctionGraph(
+    ) : m_Bounds{ 0, 0 },
+        m_Offsets(1, 0),
+        m_Edges(),
+        m_NodeCells(),
+        m_NodeOf(),
+        m_IsOverflow(),
+        m_Overflow(),
+        m_DeadCount(0),
+        m_Distances(),
+        m_ParentNodes(),
+        m_ParentLegs(),
+        m_Touched(),
+        m_Open(),
+        m_ExpandedCount(0) {
+    }
+
+    //############################################################################//
+    // | CONSTRUCTION |
+    //############################################################################//
+
+    void JunctionGraph::build(const Maze2D& maze) {
+        const size_t cells = maze.get_size();
+        m_Bounds    = maze.get_bounds();
+        m_DeadCount = 0;
+        m_NodeOf.assign(cells, s_NoNode);
+        m_NodeCells.clear();
+        m_Overflow.clear();
+
+        for (Index flat = 0; flat < static_cast<Index>(cells); ++flat) {
+            if (degree(maze, flat) == 2) continue;
+            m_NodeOf[flat] = static_cast<uint32_t>(m_NodeCells.size());
+            m_NodeCells.push_back(flat);
+        }
+
+        // Every opening of a node starts exactly one corridor, so the CSR layout is known upfront
+        const size_t nodes = m_NodeCells.size();
+        m_Offsets.assign(nodes + 1, 0);
+        for (size_t i = 0; i < nodes; ++i) {
+            m_Offsets[i + 1] = m_Offsets[i] + degree(maze, m_NodeCells[i]);
+        }
+        m_Edges.resize(m_Offsets.back());
+        m_IsOverflow.assign(nodes, 0);
+
+        ThreadPool::get_shared().parallel_for(nodes, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                collect_edges(maze, m_NodeCells[i], m_Edges.data() + m_Offsets[i]);
+            }
+        }, 256);
+
+        m_Distances.clear();
+        HINFO("[JUNCTION_GRAPH]", " # Cells: {}, Nodes: {}, Edges: {}",
+              cells, nodes, m_Edges.size()
+        );
+    }
+
+    void JunctionGraph::update(const Maze2D& maze, const Index2D pos, const Cardinal dir) {
+        const Index cols = m_Bounds.col;
+        const Index a    = pos.flat(cols);
+        const Index b    = (pos + cardinal_offset(dir)).flat(cols);
+
+        // Any node whose corridors pass through (or end at) either cell is reached by walking
+        // out of the two cells on the updated maze
+        std::vector<Index> dirty{ a, b };
+        for (const Index cell : { a, b }) {
+            for_each_open(maze, cell, [&](const Cardinal out, Index) {
+                dirty.push_back(walk(maze, cell, out, -1).cell);
+            });
+        }
+        std::sort(dirty.begin(), dirty.end());
+        dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+        // Promote & Demote first so every corridor end has an id
+        for (const Index cell : dirty) {
+            const bool     is_junction = degree(maze, cell) != 2;
+            const uint32_t node        = m_NodeOf[cell];
+
+            if (is_junction && node == s_NoNode) {
+                add_node(cell);
+            } else if (!is_junction && node != s_NoNode) {
+                m_NodeCells[node]  = s_DeadNode;
+                m_NodeOf[cell]     = s_NoNode;
+                m_IsOverflow[node] = 1;
+                m_Overflow.erase(node);
+                ++m_DeadCount;
+            }
+        }
+
+        for (const Index cell : dirty) {
+            const uint32_t node = m_NodeOf[cell];
+            if (node == s_NoNode) continue;
+
+            std::vector<Edge>& edges = m_Overflow[node];
+            edges.resize(degree(maze, cell));
+            collect_edges(maze, cell, edges.data());
+            m_IsOverflow[node] = 1;
+        }
+    }
+
+    void JunctionGraph::compact() {
+        const size_t          nodes = m_NodeCells.size();
+        std::vector<uint32_t> offsets(nodes + 1, 0);
+        std::vector<Edge>     edges{};
+        edges.reserve(m_Edges.size());
+
+        for (uint32_t node = 0; node < nodes; ++node) {
+            for_each_edge(node, [&](const Edge& edge) { edges.push_back(edge); });
+            offsets[node + 1] = static_cast<uint32_t>(edges.size());
+        }
+
+        m_Offsets.swap(offsets);
+        m_Edges.swap(edges);
+        m_Overflow.clear();
+        m_IsOverflow.assign(nodes, 0);
+    }
+
+    //############################################################################//
+    // | QUERIES |
+    //############################################################################//
+
+    JunctionGraph::Route JunctionGraph::find_route(
+            const Maze2D& maze,
+            const Index2D start,
+            const Index2D goal
+    ) {
+        maze.check_index(start);
+        maze.check_index(goal);
+        reset_query();
+
+        Route       route{};
+        const Index cols = m_Bounds.col;
+        const Index from = start.flat(cols);
+        const Index to   = goal.flat(cols);
+        if (from == to) {
+            route.length = 0;
+            return route;
+        }
+
+        // Nodes which lead to the goal along with the leg from them to the goal
+        struct GoalLeg {
+            uint32_t node;
+            Leg      leg;
+        };
+        std::array<GoalLeg, s_CardinalCount> goal_legs{};
+        size_t                               goal_count = 0;
+
+        if (is_node(to)) {
+            goal_legs[goal_count++] = GoalLeg{ m_NodeOf[to], Leg{ to, Cardinal::NORTH, 0 } };
+        } else {
+            for_each_open(maze, to, [&](const Cardinal dir, Index) {
+                const WalkEnd end = walk(maze, to, dir, -1);
+                if (end.cell == to) return;
+                goal_legs[goal_count++] = GoalLeg{
+                        m_NodeOf[end.cell],
+                        Leg{ end.cell, opposite(end.last_dir), end.length }
+                };
+            });
+        }
+
+        // Start & Goal on the same corridor are joined without touching the graph
+        std::optional<Leg> direct{};
+        if (is_node(from)) {
+            relax(m_NodeOf[from], 0, s_NoNode, Leg{ from, Cardinal::NORTH, 0 }, goal);
+        } else {
+            const Index stop = is_node(to) ? -1 : to;
+            for_each_open(maze, from, [&](const Cardinal dir, Index) {
+                const WalkEnd end = walk(maze, from, dir, stop);
+                if (end.cell == stop) {
+                    if (end.length < route.length) {
+                        route.length = end.length;
+                        direct       = Leg{ from, dir, end.length };
+                    }
+                    return;
+                }
+                if (end.cell == from) return;
+                relax(m_NodeOf[end.cell], end.length, s_NoNode,
+                      Leg{ from, dir, end.length }, goal
+                );
+            });
+        }
+
+        uint32_t best_node = s_NoNode;
+        Leg      best_leg{};
+        while (!m_Open.empty() && m_Open.top_key() < route.length) {
+            const uint32_t node     = static_cast<uint32_t>(m_Open.pop());
+            const uint32_t distance = m_Distances[node];
+            ++m_ExpandedCount;
+
+            for (size_t i = 0; i < goal_count; ++i) {
+                const GoalLeg& exit = goal_legs[i];
+                if (exit.node != node || distance + exit.leg.length >= route.length) continue;
+                route.length = distance + exit.leg.length;
+                best_node    = node;
+                best_leg     = exit.leg;
+                direct.reset();
+            }
+
+            for_each_edge(node, [&](const Edge& edge) {
+                relax(edge.target, distance + edge.weight, node,
+                      Leg{ m_NodeCells[node], edge.first_dir, edge.weight }, goal
+                );
+            });
+        }
+
+        if (direct.has_value()) {
+            route.legs.push_back(*direct);
+            return route;
+        }
+        if (best_node == s_NoNode) return route;
+
+        if (best_leg.length > 0) route.legs.push_back(best_leg);
+        for (uint32_t node = best_node; node != s_NoNode; node = m_ParentNodes[node]) {
+            const Leg& leg = m_ParentLegs[node];
+            if (leg.length > 0) route.legs.push_back(leg);
+        }
+        std::reverse(route.legs.begin(), route.legs.end());
+        return route;
+    }
+
+    std::vector<Index> JunctionGraph::expand_route(
+            const Maze2D& maze,
+            const Index2D start,
+            const Route& route
+    ) const {
+        std::vector<Index> path{};
+        if (!route.is_found()) return path;
+
+        const Index cols = m_Bounds.col;
+        path.reserve(route.length + 1);
+        path.push_back(start.flat(cols));
+
+        for (const Leg& leg : route.legs) {
+            Index    pos = leg.from;
+            Cardinal dir = leg.dir;
+            for (uint32_t i = 0; i < leg.length; ++i) {
+                pos += flat_offset(dir, cols);
+                path.push_back(pos);
+                if (i + 1 < leg.length) dir = corridor_exit(maze, pos, dir);
+            }
+        }
+        return path;
+    }
+
+    //############################################################################//
+    // | STATISTICS |
+    //############################################################################//
+
+    size_t JunctionGraph::get_edge_count() const {
+        size_t count = 0;
+        for (uint32_t node = 0; node < m_NodeCells.size(); ++node) {
+            for_each_edge(node, [&](const Edge&) { ++count; });
+        }
+        return count;
+    }
+
+    size_t JunctionGraph::get_state_bytes() const {
+        size_t overflow = 0;
+        for (const auto& [_, edges] : m_Overflow) overflow += edges.capacity() * sizeof(Edge);
+
+        return m_Offsets.capacity() * sizeof(uint32_t)
+               + m_Edges.capacity() * sizeof(Edge)
+               + m_NodeCells.capacity() * sizeof(Index)
+               + m_NodeOf.capacity() * sizeof(uint32_t)
+               + m_IsOverflow.capacity()
+               + overflow
+               + (m_Distances.capacity() + m_ParentNodes.capacity()) * sizeof(uint32_t)
+               + m_ParentLegs.capacity() * sizeof(Leg)
+               + m_Open.get_bytes();
+    }
+
+    //############################################################################//
+    // | CORRIDOR WALKING |
+    //############################################################################//
+
+    uint32_t JunctionGraph::degree(const Maze2D& maze, const Index flat) {
+        uint32_t count = 0;
+        for_each_open(maze, flat, [&](Cardinal, Index) { ++count; });
+        return count;
+    }
+
+    Cardinal JunctionGraph::corridor_exit(
+            const Maze2D& maze,
+            const Index flat,
+            const Cardinal entered
+    ) {
+        Cardinal exit = entered;
+        for_each_open(maze, flat, [&](const Cardinal dir, Index) {
+            if (dir != opposite(entered)) exit = dir;
+        });
+        return exit;
+    }
+
+    JunctionGraph::WalkEnd JunctionGraph::walk(
+            const Maze2D& maze,
+            const Index flat,
+            const Cardinal dir,
+            const Index stop
+    ) {
+        const Index cols = maze.get_col_count();
+        Index       pos  = flat + flat_offset(dir, cols);
+        WalkEnd     end{ pos, 1, dir };
+
+        // Returning to 'flat' only happens on a loop of corridor cells without any junction
+        while (pos != stop && pos != flat && degree(maze, pos) == 2) {
+            end.last_dir = corridor_exit(maze, pos, end.last_dir);
+            pos += flat_offset(end.last_dir, cols);
+            ++end.length;
+        }
+
+        end.cell = pos;
+        return end;
+    }
+
+    void JunctionGraph::collect_edges(const Maze2D& maze, const Index flat, Edge* out) const {
+        for_each_open(maze, flat, [&](const Cardinal dir, Index) {
+            const WalkEnd end = walk(maze, flat, dir, -1);
+            *out++ = Edge{ m_NodeOf[end.cell], end.length, dir };
+        });
+    }
+
+    uint32_t JunctionGraph::add_node(const Index flat) {
+        const uint32_t node = static_cast<uint32_t>(m_NodeCells.size());
+        m_NodeCells.push_back(flat);
+        m_NodeOf[flat] = node;
+        m_IsOverflow.push_back(1);
+        return node;
+    }
+
+    void JunctionGraph::reset_query() {
+        const size_t nodes = m_NodeCells.size();
+        m_ExpandedCount = 0;
+
+        if (m_Distances.size() != nodes) {
+            m_Distances.assign(nodes, s_Unreached);
+            m_ParentNodes.assign(nodes, s_NoNode);
+            m_ParentLegs.resize(nodes);
+            m_Open.resize(nodes);
+            m_Touched.clear();
+            return;
+        }
+
+        for (const uint32_t node : m_Touched) m_Distances[node] = s_Unreached;
+        m_Touched.clear();
+        m_Open.clear();
+    }
+
+    void JunctionGraph::relax(
+            const uint32_t node,
+            const uint32_t distance,
+            const uint32_t parent,
+            const Leg leg,
+            const Index2D goal
+    ) {
+        if (distance >= m_Distances[node]) return;
+        if (m_Distances[node] == s_Unreached) m_Touched.push_back(node);
+
+        m_Distances[node]   = distance;
+        m_ParentNodes[node] = parent;
+        m_ParentLegs[node]  = leg;
+
+        const Index   cell = m_NodeCells[node];
+        const Index2D pos{ cell / m_Bounds.col, cell % m_Bounds.col };
+        m_Open.push_or_decrease(
+                static_cast<Index>(node),
+                distance + ManhattanHeuristic::estimate(pos, goal)
+        );
+    }
+
+} // maze
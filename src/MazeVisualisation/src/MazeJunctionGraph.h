@@ -0,0 +1,158 @@
+//
+// Header File: MazeJunctionGraph.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEJUNCTIONGRAPH_H
+#define MAZEVISUALISATION_MAZEJUNCTIONGRAPH_H
+
+#include "MazeConstructs.h"
+#include "MazeParallel.h"
+#include "MazeSolvers.h"
+
+#include <optional>
+#include <unordered_map>
+
+namespace maze {
+
+    //############################################################################//
+    // | JUNCTION GRAPH |
+    //############################################################################//
+
+    // Corridor compressed view of a maze; every cell without exactly two openings (junctions,
+    // dead ends & isolated cells) is a node and each corridor between two nodes is a weighted
+    // edge. Adjacency is held in CSR arrays; nodes touched by update() are tombstoned and their
+    // edges moved to an overflow map until compact() folds them back in. Node ids are stable
+    // across updates & compaction, nodes which stop being junctions are only marked dead.
+    class JunctionGraph {
+
+    public:
+        inline static constexpr uint32_t s_NoNode    = UINT32_MAX;
+        inline static constexpr uint32_t s_Unreached = UINT32_MAX;
+        inline static constexpr Index    s_DeadNode  = -1;
+
+        struct Edge {
+            uint32_t target;
+            uint32_t weight;
+            Cardinal first_dir;
+        };
+
+        // 'length' steps starting at 'from' leaving through 'dir', then following the corridor
+        struct Leg {
+            Index    from;
+            Cardinal dir;
+            uint32_t length;
+        };
+
+        struct Route {
+            uint32_t         length = s_Unreached;
+            std::vector<Leg> legs{};
+
+            bool is_found() const {
+                return length != s_Unreached;
+            }
+        };
+
+    private:
+        using OverflowMap = std::unordered_map<uint32_t, std::vector<Edge>>;
+
+        // End of a corridor walk
+        struct WalkEnd {
+            Index    cell;
+            uint32_t length;
+            Cardinal last_dir;
+        };
+
+    private:
+        Index2D               m_Bounds;
+        std::vector<uint32_t> m_Offsets;
+        std::vector<Edge>     m_Edges;
+        std::vector<Index>    m_NodeCells;
+        std::vector<uint32_t> m_NodeOf;
+        std::vector<uint8_t>  m_IsOverflow;
+        OverflowMap           m_Overflow;
+        size_t                m_DeadCount;
+
+        // Query State; only the touched entries are reset between queries
+        std::vector<uint32_t> m_Distances;
+        std::vector<uint32_t> m_ParentNodes;
+        std::vector<Leg>      m_ParentLegs;
+        std::vector<uint32_t> m_Touched;
+        IndexedMinHeap<4>     m_Open;
+        size_t                m_ExpandedCount;
+
+    public:
+        JunctionGraph();
+
+    public:
+        void build(const Maze2D& maze);
+
+        // Re-derives the edges around a wall opened by 'maze.make_path(pos, dir)'
+        void update(const Maze2D& maze, Index2D pos, Cardinal dir);
+
+        // Folds the overflow edges back into the CSR arrays
+        void compact();
+
+        // A* over the junction nodes (Manhattan); endpoints may be any cell
+        Route find_route(const Maze2D& maze, Index2D start, Index2D goal);
+
+        // Flat cells from start to goal (inclusive) for a route found on the same maze
+        std::vector<Index> expand_route(
+                const Maze2D& maze,
+                Index2D start,
+                const Route& route
+        ) const;
+
+    public:
+        size_t get_node_count() const {
+            return m_NodeCells.size() - m_DeadCount;
+        }
+
+        size_t get_edge_count() const;
+
+        size_t get_overflow_count() const {
+            return m_Overflow.size();
+        }
+
+        size_t get_expanded_count() const {
+            return m_ExpandedCount;
+        }
+
+        size_t get_state_bytes() const;
+
+        bool is_node(const Index flat) const {
+            return m_NodeOf[flat] != s_NoNode;
+        }
+
+        Index get_node_cell(const uint32_t node) const {
+            return m_NodeCells[node];
+        }
+
+        template<class Function>
+        void for_each_edge(const uint32_t node, Function fn) const {
+            if (m_IsOverflow[node]) {
+                const auto it = m_Overflow.find(node);
+                if (it == m_Overflow.end()) return;
+                for (const Edge& edge : it->second) fn(edge);
+                return;
+            }
+
+            for (uint32_t i = m_Offsets[node]; i < m_Offsets[node + 1]; ++i) fn(m_Edges[i]);
+        }
+
+    private:
+        static uint32_t degree(const Maze2D& maze, Index flat);
+        static Cardinal corridor_exit(const Maze2D& maze, Index flat, Cardinal entered);
+        static WalkEnd walk(const Maze2D& maze, Index flat, Cardinal dir, Index stop);
+
+        void collect_edges(const Maze2D& maze, Index flat, Edge* out) const;
+        uint32_t add_node(Index flat);
+        void reset_query();
+        void relax(uint32_t node, uint32_t distance, uint32_t parent, Leg leg, Index2D goal);
+    };
+
+} // maze
+
+#endif
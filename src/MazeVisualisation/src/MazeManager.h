@@ -7,17 +7,20 @@
 
 #include "PlayerManager.h"
 #include "MazeGeneratorManager.h"
+#include "MazeSolverManager.h"
 
 #include "CommonModelFileReaders.h"
 #include "MazeConstructs.h"
 #include "Renderer/Shader.h"
 #include "MazeWall.h"
+#include "MazeWallExtractor.h"
 #include "BoundingBox.h"
 
 #include "Image.h"
 #include "Renderer/Texture2D.h"
 #include "Renderer/DefaultHandlers.h"
 #include "MazeTextureManager.h"
+#include "MazeChunks.h"
 
 namespace maze {
 
@@ -83,18 +86,31 @@ namespace maze {
     private:
         MazePtr              m_Maze;
         MazeGeneratorManager m_GeneratorManager;
+        MazeSolverManager    m_SolverManager;
         PlayerManager        m_PlayerManager;
         MazeTextureManager   m_TextureManager;
         GameState            m_GameState;
         float                m_Theta;
 
+        // Unbounded World (Player Solving); m_Maze becomes a window onto the world. The world and
+        // its generation thread are only created the first time it is entered.
+        std::unique_ptr<ChunkedMaze> m_World;
+        Index2D                      m_WorldOrigin;
+        std::optional<Maze2D>        m_FiniteMaze;
+        bool                         m_IsWorldDirty;
+
     public:
         MazeManager()
                 : m_Maze(std::make_shared<Maze2D>(s_MazeSize, s_MazeSize)),
                   m_GeneratorManager(),
+                  m_SolverManager(),
                   m_PlayerManager(),
                   m_GameState(GameState::MAZE_GENERATION),
-                  m_Theta() {
+                  m_Theta(),
+                  m_World(),
+                  m_WorldOrigin(),
+                  m_FiniteMaze(),
+                  m_IsWorldDirty(false) {
         }
 
     public:
@@ -122,7 +138,9 @@ namespace maze {
             group.add_group_handler<ShaderHandler>(app);
 
             // Individual Walls
-            m_Maze->for_each_wall_unique([&](Cardinal dir, const Index2D& pos, Cell cell) {
+            WallExtractor walls{};
+            walls.extract(*m_Maze);
+            walls.for_each_wall([&](const Cardinal dir, const Index2D pos) {
                 app::Entity entity;
                 entity.add_entity_handler<MazeWall>(m_Maze, pos, dir);
                 entity.update(group, 0.0);
@@ -169,12 +187,15 @@ namespace maze {
 
             // Switching Game State
             if (app->is_key_down(app::Key::NUM_1)) {
+                leave_world();
                 m_GameState = GameState::MAZE_GENERATION;
                 app->get_camera_state().cam_pos = glm::vec3{ 0 };
                 app->set_global_scale(glm::vec3{ 1 });
             }
 
             if (app->is_key_down(app::Key::NUM_2)) {
+                leave_world();
+                m_SolverManager.restart();
                 m_GameState = GameState::ALGORITHM_SOLVING;
                 app->get_camera_state().cam_pos = glm::vec3{ 0 };
                 app->set_global_scale(glm::vec3{ 2.5, 1, 2.5 });
@@ -194,15 +215,89 @@ namespace maze {
                 }
 
                 case GameState::ALGORITHM_SOLVING: {
+                    m_SolverManager.update(app, *m_Maze, delta);
                     break;
                 }
 
                 case GameState::PLAYER_SOLVING: {
-                    m_PlayerManager.update(app, *m_Maze, delta);
+                    if (app->is_key_down(app::Key::I)) {
+                        if (m_FiniteMaze.has_value()) {
+                            leave_world();
+                        } else {
+                            enter_world(app);
+                        }
+                    }
+
+                    if (m_FiniteMaze.has_value()) {
+                        update_world(app, delta);
+                    } else {
+                        m_PlayerManager.update(app, *m_Maze, delta);
+                    }
                     break;
                 }
             }
         }
+
+        //############################################################################//
+        // | UNBOUNDED WORLD |
+        //############################################################################//
+
+    private:
+
+        void enter_world(app::Application* app) {
+            if (m_World == nullptr) m_World = std::make_unique<ChunkedMaze>(std::random_device{}());
+            m_FiniteMaze.emplace(*m_Maze);
+            m_WorldOrigin  = Index2D{ 0, 0 };
+            m_IsWorldDirty = true;
+            app->get_camera_state().cam_pos = glm::vec3{ 0 };
+            HINFO("[MAZE_MANAGER]", " # Entered Unbounded World...");
+        }
+
+        void leave_world() {
+            if (!m_FiniteMaze.has_value()) return;
+            *m_Maze = std::move(m_FiniteMaze.value());
+            m_FiniteMaze.reset();
+            HINFO("[MAZE_MANAGER]", " # Left Unbounded World...");
+        }
+
+        void update_world(app::Application* app, float delta) {
+            m_World->poll();
+
+            // Re-centre the window once the player drifts towards its edge; the camera is shifted
+            // by the same amount so that the move is seamless.
+            constexpr Index centre = s_MazeSize / 2;
+            constexpr Index margin = s_MazeSize / 4;
+            const Index2D   player = PlayerManager::get_player_cell(app);
+            Index2D         shift{ 0, 0 };
+
+            if (player.row < margin || player.row >= s_MazeSize - margin) {
+                shift.row = player.row - centre;
+            }
+
+            if (player.col < margin || player.col >= s_MazeSize - margin) {
+                shift.col = player.col - centre;
+            }
+
+            if (!(shift == Index2D{ 0, 0 })) {
+                auto& cam_state = app->get_camera_state();
+                const float dx = shift.row * PlayerManager::s_PlayingWallScale;
+                const float dz = shift.col * PlayerManager::s_PlayingWallScale;
+                cam_state.cam_pos.x -= dx;
+                cam_state.cam_pos.z -= dz;
+                cam_state.cam_delta_pos.x -= dx;
+                cam_state.cam_delta_pos.z -= dz;
+
+                m_WorldOrigin  = m_WorldOrigin + shift;
+                m_IsWorldDirty = true;
+            }
+
+            // Only keep re-copying whilst chunks in view are still being generated
+            if (m_IsWorldDirty) {
+                m_IsWorldDirty = m_World->copy_region(m_WorldOrigin, *m_Maze) > 0;
+            }
+
+            m_PlayerManager.update(app, *m_World, m_WorldOrigin, delta);
+        }
     };
 
 }
@@ -0,0 +1,190 @@
+//
+// Header File: MazeParallel.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEPARALLEL_H
+#define MAZEVISUALISATION_MAZEPARALLEL_H
+
+#include "MazeConstructs.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace maze {
+
+    //############################################################################//
+    // | THREAD POOL |
+    //############################################################################//
+
+    // Fixed set of workers that execute batches of indexed tasks. The calling thread takes part
+    // in every batch so a pool of N threads has N - 1 workers. Batches are not re-entrant; a task
+    // must not submit another batch to the same pool.
+    class ThreadPool {
+
+    public:
+        using Task = std::function<void(size_t)>;
+
+    private:
+        std::vector<std::thread> m_Workers;
+        std::mutex               m_BatchMutex;
+        std::mutex               m_Mutex;
+        std::condition_variable  m_Signal;
+        std::condition_variable  m_Done;
+        const Task*              m_Task;
+        size_t                   m_TaskCount;
+        std::atomic<size_t>      m_NextTask;
+        std::atomic<size_t>      m_Completed;
+        size_t                   m_Generation;
+        size_t                   m_ActiveWorkers;
+        bool                     m_IsRunning;
+
+    public:
+        explicit ThreadPool(
+                size_t thread_count = std::max(1U, std::thread::hardware_concurrency())
+        ) : m_Workers(),
+            m_Task(nullptr),
+            m_TaskCount(0),
+            m_NextTask(0),
+            m_Completed(0),
+            m_Generation(0),
+            m_ActiveWorkers(0),
+            m_IsRunning(true) {
+
+            for (size_t i = 1; i < thread_count; ++i) {
+                m_Workers.emplace_back([this]() { worker_loop(); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard lock{ m_Mutex };
+                m_IsRunning = false;
+            }
+            m_Signal.notify_all();
+            for (std::thread& worker : m_Workers) worker.join();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator =(const ThreadPool&) = delete;
+
+    public:
+
+        // Process wide pool sized to the hardware
+        static ThreadPool& get_shared() {
+            static ThreadPool s_Pool{};
+            return s_Pool;
+        }
+
+        size_t get_thread_count() const {
+            return m_Workers.size() + 1;
+        }
+
+        // Runs fn(i) for every i in [0, task_count) and blocks until all have finished
+        void run(size_t task_count, const Task& fn) {
+            if (task_count == 0) return;
+            if (task_count == 1 || m_Workers.empty()) {
+                for (size_t i = 0; i < task_count; ++i) fn(i);
+                return;
+            }
+
+            std::lock_guard batch_lock{ m_BatchMutex };
+            {
+                std::lock_guard lock{ m_Mutex };
+                m_Task      = &fn;
+                m_TaskCount = task_count;
+                m_NextTask.store(0);
+                m_Completed.store(0);
+                ++m_Generation;
+            }
+            m_Signal.notify_all();
+
+            execute_tasks(fn, task_count);
+
+            // Workers still inside the batch would otherwise claim tasks from the next one
+            std::unique_lock lock{ m_Mutex };
+            m_Done.wait(lock, [&]() {
+                return m_Completed.load() == task_count && m_ActiveWorkers == 0;
+            });
+            m_Task = nullptr;
+        }
+
+        // Splits [0, count) into contiguous ranges and runs fn(begin, end) for each
+        template<class Function>
+        void parallel_for(size_t count, Function fn, size_t min_range = 1) {
+            // Without workers the range runs inline, skipping the batch & its task wrapper
+            if (m_Workers.empty()) {
+                if (count != 0) fn(size_t{ 0 }, count);
+                return;
+            }
+
+            const size_t ranges = std::clamp<size_t>(
+                    count / std::max<size_t>(min_range, 1),
+                    1,
+                    get_thread_count() * 4
+            );
+            const size_t step = (count + ranges - 1) / ranges;
+
+            run(ranges, [&](size_t task) {
+                const size_t begin = task * step;
+                const size_t end   = std::min(count, begin + step);
+                if (begin < end) fn(begin, end);
+            });
+        }
+
+        // Splits the maze into bands of whole rows and runs fn(row_begin, row_end) for each
+        template<class Function>
+        void for_each_row_band(const Maze2D& maze, Function fn, size_t min_rows = 1) {
+            parallel_for(
+                    static_cast<size_t>(maze.get_row_count()),
+                    [&](size_t begin, size_t end) {
+                        fn(static_cast<Index>(begin), static_cast<Index>(end));
+                    },
+                    min_rows
+            );
+        }
+
+    private:
+        void execute_tasks(const Task& fn, size_t task_count) {
+            size_t task;
+            while ((task = m_NextTask.fetch_add(1)) < task_count) {
+                fn(task);
+                if (m_Completed.fetch_add(1) + 1 == task_count) {
+                    std::lock_guard lock{ m_Mutex };
+                    m_Done.notify_all();
+                }
+            }
+        }
+
+        void worker_loop() {
+            size_t seen = 0;
+            while (true) {
+                const Task* task       = nullptr;
+                size_t      task_count = 0;
+                {
+                    std::unique_lock lock{ m_Mutex };
+                    m_Signal.wait(lock, [&]() { return !m_IsRunning || m_Generation != seen; });
+                    if (!m_IsRunning) return;
+
+                    seen       = m_Generation;
+                    task       = m_Task;
+                    task_count = m_TaskCount;
+                    if (task != nullptr) ++m_ActiveWorkers;
+                }
+                if (task == nullptr) continue;
+
+                execute_tasks(*task, task_count);
+                std::lock_guard lock{ m_Mutex };
+                if (--m_ActiveWorkers == 0) m_Done.notify_all();
+            }
+        }
+    };
+
+} // maze
+
+#endif
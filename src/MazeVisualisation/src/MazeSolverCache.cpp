@@ -0,0 +1,108 @@
+//
+// Header File: MazeSolverCache.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeSolverCache.h"
+
+namespace maze {
+
+    SolverCache::SolverCache(
+            size_t budget
+    ) : m_Entries(budget),
+        m_Bfs(),
+        m_Path(),
+        m_HitCount(0),
+        m_MissCount(0) {
+    }
+
+    //############################################################################//
+    // | QUERIES |
+    //############################################################################//
+
+    SolverCache::Key SolverCache::make_key(
+            const Maze2D& maze,
+            const Index2D start,
+            const Index2D goal,
+            const size_t solver
+    ) {
+        maze.check_index(start);
+        maze.check_index(goal);
+        return Key{
+                maze.get_hash(),
+                maze.get_bounds(),
+                start.flat(maze.get_col_count()),
+                goal.flat(maze.get_col_count()),
+                solver
+        };
+    }
+
+    const std::vector<Index>& SolverCache::find_path(
+            const Maze2D& maze,
+            const Index2D start,
+            const Index2D goal,
+            const size_t solver
+    ) {
+        const Key   key  = make_key(maze, start, goal, solver);
+        const Index cols = maze.get_col_count();
+
+        if (const Entry* entry = m_Entries.find(key)) {
+            ++m_HitCount;
+            unpack_path(*entry, key.start, cols);
+            return m_Path;
+        }
+
+        ++m_MissCount;
+        MazeSolver search = get_maze_solver(solver);
+        search->set_endpoints(start, goal);
+        search->solve(maze);
+        m_Path = search->get_path();
+
+        // Neighbouring cells differ by one row or one column; rows are checked first so a
+        // single column maze is not mistaken for east/west
+        const size_t moves = m_Path.empty() ? 0 : m_Path.size() - 1;
+        Entry        entry{ search->is_solved(), DirectionPlane{ moves }, nullptr };
+        for (size_t i = 1; i < m_Path.size(); ++i) {
+            const Index delta = m_Path[i] - m_Path[i - 1];
+            entry.moves.set(i - 1, delta == -cols ? Cardinal::NORTH
+                                   : delta == cols ? Cardinal::SOUTH
+                                   : delta == 1 ? Cardinal::EAST
+                                   : Cardinal::WEST);
+        }
+
+        const size_t cost = sizeof(Key) + sizeof(Entry) + entry.moves.get_bytes();
+        m_Entries.put(key, std::move(entry), cost);
+        return m_Path;
+    }
+
+    SolverCache::FieldPtr SolverCache::get_distance_field(const Maze2D& maze, const Index2D source) {
+        const Key key = make_key(maze, source, source, s_FieldQuery);
+
+        if (const Entry* entry = m_Entries.find(key)) {
+            ++m_HitCount;
+            return entry->field;
+        }
+
+        ++m_MissCount;
+        FieldPtr     field = std::make_shared<const DistanceField>(m_Bfs.compute(maze, source));
+        const size_t cost  = sizeof(Key) + sizeof(Entry) + field->capacity() * sizeof(uint32_t);
+        m_Entries.put(key, Entry{ true, DirectionPlane{}, field }, cost);
+        return field;
+    }
+
+    void SolverCache::unpack_path(const Entry& entry, const Index start, const Index cols) {
+        m_Path.clear();
+        if (!entry.is_solved) return;
+
+        Index pos = start;
+        m_Path.reserve(entry.moves.get_size() + 1);
+        m_Path.push_back(pos);
+        for (size_t i = 0; i < entry.moves.get_size(); ++i) {
+            pos += flat_offset(entry.moves.get(i), cols);
+            m_Path.push_back(pos);
+        }
+    }
+
+} // maze
@@ -0,0 +1,116 @@
+//
+// Header File: MazeSolverCache.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZESOLVERCACHE_H
+#define MAZEVISUALISATION_MAZESOLVERCACHE_H
+
+#include "MazeConstructs.h"
+#include "MazeDistanceField.h"
+#include "MazeSolvers.h"
+#include "LruCache.h"
+
+#include <memory>
+
+namespace maze {
+
+    //############################################################################//
+    // | SOLVER RESULT CACHE |
+    //############################################################################//
+
+    // Remembers solver outputs keyed by the maze's Zobrist hash (see Maze2D::get_hash) & the
+    // query so a repeated query is answered without touching the grid. Any change to the walls
+    // or costs changes the hash, so results for an older maze are simply never matched again and
+    // age out of the LRU; nothing has to be invalidated explicitly.
+    //
+    // Paths are stored as two bit moves from the start; distance fields are shared so a hit
+    // hands out the same field without copying it. Not thread-safe.
+    class SolverCache {
+
+    public:
+        inline static constexpr size_t s_DefaultBudget = 64 * 1024 * 1024;
+        inline static constexpr size_t s_FieldQuery    = SIZE_MAX;
+
+        using FieldPtr = std::shared_ptr<const DistanceField>;
+
+    private:
+        struct Key {
+            uint64_t hash;
+            Index2D  bounds;
+            Index    start;
+            Index    goal;
+            size_t   solver;
+
+            bool operator ==(const Key& o) const = default;
+        };
+
+        struct KeyHasher {
+            size_t operator ()(const Key& key) const {
+                uint64_t h = splitmix64(key.hash ^ pack_index(key.bounds));
+                h = splitmix64(h ^ pack_index(Index2D{ key.start, key.goal }));
+                return static_cast<size_t>(splitmix64(h ^ key.solver));
+            }
+        };
+
+        // Either a packed path (moves.get_size() steps from start) or a distance field
+        struct Entry {
+            bool           is_solved;
+            DirectionPlane moves;
+            FieldPtr       field;
+        };
+
+    private:
+        LruCache<Key, Entry, KeyHasher> m_Entries;
+        DirectionOptimisingBfs          m_Bfs;
+        std::vector<Index>              m_Path;
+        size_t                          m_HitCount;
+        size_t                          m_MissCount;
+
+    public:
+        explicit SolverCache(size_t budget = s_DefaultBudget);
+
+    public:
+        // Path from start to goal (inclusive) as found by the solver at 'solver' in
+        // s_MazeSolverFactories; empty if unsolvable. Valid until the next call.
+        const std::vector<Index>& find_path(
+                const Maze2D& maze,
+                Index2D start,
+                Index2D goal,
+                size_t solver = 0
+        );
+
+        // Step distances from the source to every cell
+        FieldPtr get_distance_field(const Maze2D& maze, Index2D source);
+
+        void clear() {
+            m_Entries.clear();
+        }
+
+        size_t get_hit_count() const {
+            return m_HitCount;
+        }
+
+        size_t get_miss_count() const {
+            return m_MissCount;
+        }
+
+        size_t get_entry_count() const {
+            return m_Entries.get_size();
+        }
+
+        // Bytes held by cached results
+        size_t get_cached_bytes() const {
+            return m_Entries.get_total_cost();
+        }
+
+    private:
+        static Key make_key(const Maze2D& maze, Index2D start, Index2D goal, size_t solver);
+        void unpack_path(const Entry& entry, Index start, Index cols);
+    };
+
+} // maze
+
+#endif
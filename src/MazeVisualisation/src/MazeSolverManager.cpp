@@ -0,0 +1,133 @@
+//
+// Header File: MazeSolverManager.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeSolverManager.h"
+
+namespace maze {
+
+    MazeSolverManager::MazeSolverManager(
+
+    ) : m_Solver(s_MazeSolverFactories[0]()),
+        m_StepsPerUpdate(s_MinSteps),
+        m_IsPaused(true),
+        m_Theta(0),
+        m_CurrentSolver(0),
+        m_Race(),
+        m_IsRacing(false),
+        m_IsWinnerShown(false) {
+        HINFO("[MSM]", " # Maze Solver: '{}'", m_Solver->get_display_name());
+    }
+
+    void MazeSolverManager::restart() {
+        m_Solver   = s_MazeSolverFactories[m_CurrentSolver]();
+        m_IsPaused = true;
+    }
+
+    void MazeSolverManager::update(app::Application* app, Maze2D& maze, float delta) {
+        m_Solver->set_canvas(&maze);
+        m_Solver->init_once(maze);
+
+        m_Theta += delta;
+
+        // Pausing
+        if (app->is_key_down(app::Key::SPACE)) m_IsPaused = !m_IsPaused;
+
+        // Steps Per Update
+        if (app->is_key_down(app::Key::Q)) m_StepsPerUpdate >>= 1;
+        if (app->is_key_down(app::Key::E)) m_StepsPerUpdate <<= 1;
+        m_StepsPerUpdate = std::clamp(m_StepsPerUpdate, s_MinSteps, s_MaxSteps);
+
+        // Update Current Algorithm
+        if (app->is_key_down(app::Key::PLUS)) {
+            constexpr size_t max = s_MazeSolverFactories.size();
+            ++m_CurrentSolver;
+
+            if (m_CurrentSolver >= max) {
+                m_CurrentSolver = 0;
+            }
+
+            restart();
+            HINFO("[MSM]", " # Maze Solver: '{}'", m_Solver->get_display_name());
+        }
+
+        // Restart the Solver
+        if (app->is_key_down(app::Key::R)) {
+            restart();
+        }
+
+        // Race every solver; the stepped solver is paused so only the winner paints
+        if (app->is_key_down(app::Key::C)) {
+            start_race(maze);
+        }
+
+        if (m_IsRacing) {
+            poll_race(maze);
+            return;
+        }
+
+        // Update Solver
+        if (!m_IsPaused
+            && m_Solver->is_initialised()
+            && !m_Solver->is_complete()
+            && m_Theta > s_MinUpdateTimeframe) {
+            m_Solver->step(maze, m_StepsPerUpdate);
+            m_Theta = 0.0F;
+        }
+    }
+
+    //############################################################################//
+    // | SOLVER RACE |
+    //############################################################################//
+
+    void MazeSolverManager::start_race(const Maze2D& maze) {
+        if (m_IsRacing) {
+            HINFO("[MSM]", " # A solver race is already running...");
+            return;
+        }
+
+        m_IsPaused      = true;
+        m_IsRacing      = true;
+        m_IsWinnerShown = false;
+        m_Race.start(maze, Index2D{ 0, 0 }, maze.get_bounds() - Index2D{ 1, 1 });
+        HINFO("[MSM]", " # Racing {} solvers...", s_MazeSolverFactories.size());
+    }
+
+    void MazeSolverManager::poll_race(Maze2D& maze) {
+
+        // The winner is published before the finish count so this order never misses it
+        const bool   is_finished = m_Race.is_finished();
+        const size_t winner      = m_Race.get_winner();
+
+        // Winner's path is shown as soon as it exists, unless the maze was resized meanwhile
+        if (!m_IsWinnerShown && winner != SolverRace::s_NoWinner) {
+            m_IsWinnerShown = true;
+            if (maze.get_bounds() == m_Race.get_snapshot().get_bounds()) {
+                const Index cols = maze.get_col_count();
+                maze.unset_flags_all<Flag::RED, Flag::GREEN, Flag::BLUE>();
+                for (const Index flat : m_Race.get_winner_path()) {
+                    maze.set_flags(Index2D{ flat / cols, flat % cols }, { Flag::RED });
+                }
+            }
+        }
+
+        if (!is_finished) return;
+        m_IsRacing = false;
+        m_Race.wait();
+
+        for (const SolverRace::Result& result : m_Race.get_results()) {
+            HINFO("[MSM]", " # {:<28} {:>9.2f} ms  Solved: {}, Expanded: {}, State: {} B",
+                  result.name, result.solve_ms, result.is_solved, result.expanded,
+                  result.state_bytes
+            );
+        }
+
+        if (winner != SolverRace::s_NoWinner) {
+            HINFO("[MSM]", " # Winner: '{}'", m_Race.get_results()[winner].name);
+        }
+    }
+
+} // maze
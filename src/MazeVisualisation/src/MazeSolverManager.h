@@ -0,0 +1,54 @@
+//
+// Header File: MazeSolverManager.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZESOLVERMANAGER_H
+#define MAZEVISUALISATION_MAZESOLVERMANAGER_H
+
+#include "Application.h"
+#include "MazeConstructs.h"
+#include "MazeSolvers.h"
+#include "MazeSolverRace.h"
+
+namespace maze {
+
+    class MazeSolverManager {
+
+    public:
+        inline static constexpr size_t s_MinSteps           = 1;
+        inline static constexpr size_t s_MaxSteps           = 1 << 16;
+        inline static constexpr float  s_MinUpdateTimeframe = 1.0F / 30.0F;
+
+    private:
+        MazeSolver m_Solver;
+        size_t     m_StepsPerUpdate;
+        bool       m_IsPaused;
+        float      m_Theta;
+        size_t     m_CurrentSolver;
+
+        // Race of every solver on a snapshot of the maze, polled each update
+        SolverRace m_Race;
+        bool       m_IsRacing;
+        bool       m_IsWinnerShown;
+
+    public:
+        MazeSolverManager();
+
+    public:
+        void update(app::Application* app, Maze2D& maze, float delta);
+
+        // Discards the current solver state; the next update re-initialises against the maze
+        void restart();
+
+    private:
+        void start_race(const Maze2D& maze);
+        void poll_race(Maze2D& maze);
+
+    };
+
+} // maze
+
+#endif
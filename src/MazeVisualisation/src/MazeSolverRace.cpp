@@ -0,0 +1,102 @@
+//
+// Header File: MazeSolverRace.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeSolverRace.h"
+
+namespace maze {
+
+    SolverRace::SolverRace(
+    ) : m_Snapshot(),
+        m_Solvers(),
+        m_Results(),
+        m_Threads(),
+        m_FinishedCount(0),
+        m_Winner(s_NoWinner),
+        m_StartTime() {
+    }
+
+    SolverRace::~SolverRace() {
+        wait();
+    }
+
+    //############################################################################//
+    // | RACE |
+    //############################################################################//
+
+    void SolverRace::start(const Maze2D& maze, const Index2D start, const Index2D goal) {
+        this->start(std::make_shared<const Maze2D>(maze), start, goal);
+    }
+
+    void SolverRace::start(
+            std::shared_ptr<const Maze2D> snapshot,
+            const Index2D start,
+            const Index2D goal
+    ) {
+        wait();
+        snapshot->check_index(start);
+        snapshot->check_index(goal);
+
+        m_Snapshot = std::move(snapshot);
+        m_Solvers.clear();
+        m_Results.clear();
+        m_Threads.clear();
+        m_FinishedCount.store(0);
+        m_Winner.store(s_NoWinner);
+
+        // Everything a thread touches is allocated up front; each only writes its own slot
+        for (const auto& factory : s_MazeSolverFactories) {
+            MazeSolver solver = factory();
+            solver->set_endpoints(start, goal);
+            m_Results.push_back(Result{ solver->get_display_name(), false, 0.0, 0, 0, 0 });
+            m_Solvers.push_back(std::move(solver));
+        }
+
+        m_StartTime = Clock::now();
+        m_Threads.reserve(m_Solvers.size());
+        for (size_t i = 0; i < m_Solvers.size(); ++i) {
+            m_Threads.emplace_back([this, i]() { run_solver(i); });
+        }
+    }
+
+    void SolverRace::wait() {
+        for (std::thread& thread : m_Threads) {
+            if (thread.joinable()) thread.join();
+        }
+    }
+
+    const std::vector<Index>& SolverRace::get_winner_path() const {
+        static const std::vector<Index> s_Empty{};
+        const size_t winner = get_winner();
+        return winner == s_NoWinner ? s_Empty : m_Solvers[winner]->get_path();
+    }
+
+    void SolverRace::run_solver(const size_t index) {
+        AbstractMazeSolver& solver = *m_Solvers[index];
+        solver.solve(*m_Snapshot);
+
+        Result& result = m_Results[index];
+        result.is_solved   = solver.is_solved();
+        result.solve_ms    = std::chrono::duration<double, std::milli>(
+                Clock::now() - m_StartTime
+        ).count();
+        result.expanded    = solver.get_expanded_count();
+        result.path_length = solver.get_path().size();
+        result.state_bytes = solver.get_state_bytes();
+
+        // The solver is done writing its path; the winner's is safe to read from here on
+        size_t no_winner = s_NoWinner;
+        if (result.is_solved) {
+            m_Winner.compare_exchange_strong(no_winner, index, std::memory_order_acq_rel);
+        }
+        m_FinishedCount.fetch_add(1, std::memory_order_acq_rel);
+
+        HINFO("[SOLVER_RACE]", " # '{}' finished in {:.2f} ms; Solved: {}, Expanded: {}",
+              result.name, result.solve_ms, result.is_solved, result.expanded
+        );
+    }
+
+} // maze
@@ -0,0 +1,100 @@
+//
+// Header File: MazeSolverRace.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZESOLVERRACE_H
+#define MAZEVISUALISATION_MAZESOLVERRACE_H
+
+#include "MazeConstructs.h"
+#include "MazeSolvers.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace maze {
+
+    //############################################################################//
+    // | SOLVER RACE |
+    //############################################################################//
+
+    // Runs every registered solver at once, one thread each, over a single immutable copy of the
+    // maze. Solvers only read the maze and own their search state so no locking is needed; the
+    // first solver to produce a solution is the winner and its path is available straight away;
+    // the caller polls (or waits) for the rest rather than blocking on the whole race.
+    class SolverRace {
+
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        inline static constexpr size_t s_NoWinner = SIZE_MAX;
+
+        struct Result {
+            std::string name;
+            bool        is_solved;
+            double      solve_ms;    // From the start of the race
+            size_t      expanded;
+            size_t      path_length;
+            size_t      state_bytes; // Buffers never shrink so this is also the peak
+        };
+
+    private:
+        std::shared_ptr<const Maze2D> m_Snapshot;
+        std::vector<MazeSolver>       m_Solvers;
+        std::vector<Result>           m_Results;
+        std::vector<std::thread>      m_Threads;
+        std::atomic<size_t>           m_FinishedCount;
+        std::atomic<size_t>           m_Winner;
+        Clock::time_point             m_StartTime;
+
+    public:
+        SolverRace();
+        ~SolverRace();
+
+        SolverRace(const SolverRace&) = delete;
+        SolverRace& operator =(const SolverRace&) = delete;
+
+    public:
+        // Copies the maze once; later changes to it do not affect the race
+        void start(const Maze2D& maze, Index2D start, Index2D goal);
+
+        // Races over an existing snapshot which must not be modified until the race finishes
+        void start(std::shared_ptr<const Maze2D> snapshot, Index2D start, Index2D goal);
+
+        // Blocks until every solver has finished
+        void wait();
+
+        bool is_started() const {
+            return !m_Threads.empty();
+        }
+
+        bool is_finished() const {
+            return m_FinishedCount.load(std::memory_order_acquire) == m_Threads.size();
+        }
+
+        size_t get_winner() const {
+            return m_Winner.load(std::memory_order_acquire);
+        }
+
+        // Winning path (flat indices into the snapshot); empty until there is a winner
+        const std::vector<Index>& get_winner_path() const;
+
+        // One entry per solver (factory order); only valid once the race is finished
+        const std::vector<Result>& get_results() const {
+            return m_Results;
+        }
+
+        const Maze2D& get_snapshot() const {
+            return *m_Snapshot;
+        }
+
+    private:
+        void run_solver(size_t index);
+    };
+
+} // maze
+
+#endif
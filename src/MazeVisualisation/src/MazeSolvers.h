@@ -0,0 +1,1319 @@
+//
+// Header File: MazeSolvers.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZESOLVERS_H
+#define MAZEVISUALISATION_MAZESOLVERS_H
+
+#include "MazeConstructs.h"
+#include "MazeParallel.h"
+
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace maze {
+
+    //############################################################################//
+    // | SOLVER CONTAINERS |
+    //############################################################################//
+
+    // One bit per cell; replaces per-cell bool/flag state for visited/closed sets
+    class CellBitSet {
+
+    private:
+        std::vector<uint64_t> m_Words;
+        size_t                m_Size;
+
+    public:
+        explicit CellBitSet(size_t size = 0) : m_Words((size + 63) / 64, 0), m_Size(size) {}
+
+    public:
+        void resize(size_t size) {
+            m_Size = size;
+            m_Words.assign((size + 63) / 64, 0);
+        }
+
+        void clear() {
+            std::fill(m_Words.begin(), m_Words.end(), 0);
+        }
+
+        bool test(size_t i) const {
+            return (m_Words[i >> 6] >> (i & 63)) & 1ULL;
+        }
+
+        void set(size_t i) {
+            m_Words[i >> 6] |= 1ULL << (i & 63);
+        }
+
+        void reset(size_t i) {
+            m_Words[i >> 6] &= ~(1ULL << (i & 63));
+        }
+
+        // Returns the previous state
+        bool test_and_set(size_t i) {
+            uint64_t&      word = m_Words[i >> 6];
+            const uint64_t mask = 1ULL << (i & 63);
+            const bool     prev = (word & mask) != 0;
+            word |= mask;
+            return prev;
+        }
+
+        size_t count() const {
+            size_t total = 0;
+            for (const uint64_t word : m_Words) total += std::popcount(word);
+            return total;
+        }
+
+        size_t get_size() const {
+            return m_Size;
+        }
+
+        size_t get_bytes() const {
+            return m_Words.capacity() * sizeof(uint64_t);
+        }
+
+        uint64_t* data() {
+            return m_Words.data();
+        }
+
+        const uint64_t* data() const {
+            return m_Words.data();
+        }
+    };
+
+    // Two bits per cell holding a Cardinal; used for parent pointers and flow directions
+    class DirectionPlane {
+
+    private:
+        std::vector<uint64_t> m_Words;
+        size_t                m_Size;
+
+    public:
+        explicit DirectionPlane(size_t size = 0) : m_Words((size + 31) / 32, 0), m_Size(size) {}
+
+    public:
+        void resize(size_t size) {
+            m_Size = size;
+            m_Words.assign((size + 31) / 32, 0);
+        }
+
+        Cardinal get(size_t i) const {
+            return static_cast<Cardinal>((m_Words[i >> 5] >> ((i & 31) << 1)) & 3ULL);
+        }
+
+        void set(size_t i, const Cardinal dir) {
+            const size_t shift = (i & 31) << 1;
+            uint64_t&    word  = m_Words[i >> 5];
+            word = (word & ~(3ULL << shift)) | (static_cast<uint64_t>(dir) << shift);
+        }
+
+        size_t get_size() const {
+            return m_Size;
+        }
+
+        // Whole words (32 cells each); lets disjoint word ranges be written concurrently
+        size_t get_word_count() const {
+            return m_Words.size();
+        }
+
+        void set_word(size_t word, uint64_t bits) {
+            m_Words[word] = bits;
+        }
+
+        size_t get_bytes() const {
+            return m_Words.capacity() * sizeof(uint64_t);
+        }
+    };
+
+    // FIFO of flat indices backed by a power of two ring; grows by doubling when full
+    class IndexRingBuffer {
+
+    private:
+        inline static constexpr size_t s_InitialCapacity = 1024;
+
+    private:
+        std::vector<Index> m_Buffer;
+        size_t             m_Head;
+        size_t             m_Count;
+
+    public:
+        explicit IndexRingBuffer(
+                size_t capacity = s_InitialCapacity
+        ) : m_Buffer(std::bit_ceil(std::max(capacity, size_t{ 1 }))),
+            m_Head(0),
+            m_Count(0) {
+        }
+
+    public:
+        bool empty() const {
+            return m_Count == 0;
+        }
+
+        size_t size() const {
+            return m_Count;
+        }
+
+        void clear() {
+            m_Head  = 0;
+            m_Count = 0;
+        }
+
+        void push(const Index value) {
+            if (m_Count == m_Buffer.size()) grow();
+            m_Buffer[(m_Head + m_Count) & (m_Buffer.size() - 1)] = value;
+            ++m_Count;
+        }
+
+        Index front() const {
+            return m_Buffer[m_Head];
+        }
+
+        Index pop() {
+            const Index value = m_Buffer[m_Head];
+            m_Head = (m_Head + 1) & (m_Buffer.size() - 1);
+            --m_Count;
+            return value;
+        }
+
+        size_t get_bytes() const {
+            return m_Buffer.capacity() * sizeof(Index);
+        }
+
+    private:
+        void grow() {
+            std::vector<Index> next(m_Buffer.size() * 2);
+            for (size_t i = 0; i < m_Count; ++i) {
+                next[i] = m_Buffer[(m_Head + i) & (m_Buffer.size() - 1)];
+            }
+            m_Buffer.swap(next);
+            m_Head = 0;
+        }
+    };
+
+    // Flat array d-ary min heap over flat indices with decrease-key; positions are tracked in a
+    // dense per-cell array so membership and decrease-key are O(1) lookups.
+    template<size_t Arity = 4>
+    class IndexedMinHeap {
+
+    public:
+        inline static constexpr uint32_t s_NotQueued = UINT32_MAX;
+
+    private:
+        struct Node {
+            uint32_t key;
+            Index    item;
+        };
+
+    private:
+        std::vector<Node>     m_Heap;
+        std::vector<uint32_t> m_Positions;
+
+    public:
+        explicit IndexedMinHeap(size_t capacity = 0) : m_Heap(), m_Positions(capacity, s_NotQueued) {}
+
+    public:
+        void resize(size_t capacity) {
+            m_Heap.clear();
+            m_Positions.assign(capacity, s_NotQueued);
+        }
+
+        // Empties the heap in O(size) keeping the capacity
+        void clear() {
+            for (const Node& node : m_Heap) m_Positions[node.item] = s_NotQueued;
+            m_Heap.clear();
+        }
+
+        bool empty() const {
+            return m_Heap.empty();
+        }
+
+        size_t size() const {
+            return m_Heap.size();
+        }
+
+        size_t get_capacity() const {
+            return m_Positions.size();
+        }
+
+        bool contains(const Index item) const {
+            return m_Positions[item] != s_NotQueued;
+        }
+
+        uint32_t top_key() const {
+            return m_Heap.front().key;
+        }
+
+        Index top() const {
+            return m_Heap.front().item;
+        }
+
+        // Inserts the item or lowers its key; larger keys for queued items are ignored
+        void push_or_decrease(const Index item, const uint32_t key) {
+            uint32_t pos = m_Positions[item];
+            if (pos == s_NotQueued) {
+                pos = static_cast<uint32_t>(m_Heap.size());
+                m_Heap.push_back(Node{ key, item });
+                m_Positions[item] = pos;
+            } else if (key < m_Heap[pos].key) {
+                m_Heap[pos].key = key;
+            } else {
+                return;
+            }
+            sift_up(pos);
+        }
+
+        Index pop() {
+            const Index item = m_Heap.front().item;
+            m_Positions[item] = s_NotQueued;
+
+            const Node last = m_Heap.back();
+            m_Heap.pop_back();
+            if (!m_Heap.empty()) {
+                m_Heap.front()         = last;
+                m_Positions[last.item] = 0;
+                sift_down(0);
+            }
+            return item;
+        }
+
+        size_t get_bytes() const {
+            return m_Heap.capacity() * sizeof(Node) + m_Positions.capacity() * sizeof(uint32_t);
+        }
+
+    private:
+        void sift_up(uint32_t pos) {
+            const Node node = m_Heap[pos];
+            while (pos > 0) {
+                const uint32_t parent = (pos - 1) / Arity;
+                if (m_Heap[parent].key <= node.key) break;
+                m_Heap[pos] = m_Heap[parent];
+                m_Positions[m_Heap[pos].item] = pos;
+                pos = parent;
+            }
+            m_Heap[pos] = node;
+            m_Positions[node.item] = pos;
+        }
+
+        void sift_down(uint32_t pos) {
+            const Node     node  = m_Heap[pos];
+            const uint32_t count = static_cast<uint32_t>(m_Heap.size());
+            while (true) {
+                const uint32_t first = pos * Arity + 1;
+                if (first >= count) break;
+
+                // Smallest Child
+                const uint32_t last = std::min<uint32_t>(first + Arity, count);
+                uint32_t       best = first;
+                for (uint32_t child = first + 1; child < last; ++child) {
+                    if (m_Heap[child].key < m_Heap[best].key) best = child;
+                }
+
+                if (node.key <= m_Heap[best].key) break;
+                m_Heap[pos] = m_Heap[best];
+                m_Positions[m_Heap[pos].item] = pos;
+                pos = best;
+            }
+            m_Heap[pos] = node;
+            m_Positions[node.item] = pos;
+        }
+    };
+
+    // Dial's bucket queue for monotone integer keys where every pushed key is within Span of the
+    // last popped key (true for Dijkstra when edge costs are below Span); one bucket per key in a
+    // ring, so push is an append and pop scans forward at most Span buckets. There is no
+    // decrease-key, a lowered key is pushed again and the stale entry is skipped by the caller
+    // (lazy deletion), as with std::priority_queue.
+    template<size_t Span = 256>
+    class BucketQueue {
+
+        static_assert(std::has_single_bit(Span), "Span must be a power of two...");
+
+    private:
+        std::array<std::vector<Index>, Span> m_Buckets;
+        uint32_t                             m_Cursor;
+        size_t                               m_Size;
+
+    public:
+        BucketQueue() : m_Buckets(), m_Cursor(0), m_Size(0) {}
+
+    public:
+        void clear() {
+            for (std::vector<Index>& bucket : m_Buckets) bucket.clear();
+            m_Cursor = 0;
+            m_Size   = 0;
+        }
+
+        bool empty() const {
+            return m_Size == 0;
+        }
+
+        size_t size() const {
+            return m_Size;
+        }
+
+        // Key must be in [last popped key, last popped key + Span)
+        void push(const Index item, const uint32_t key) {
+            m_Buckets[key & (Span - 1)].push_back(item);
+            ++m_Size;
+        }
+
+        // Smallest key & its item; ties leave in no particular order
+        std::pair<uint32_t, Index> pop() {
+            while (m_Buckets[m_Cursor & (Span - 1)].empty()) ++m_Cursor;
+
+            std::vector<Index>& bucket = m_Buckets[m_Cursor & (Span - 1)];
+            const Index         item   = bucket.back();
+            bucket.pop_back();
+            --m_Size;
+            return { m_Cursor, item };
+        }
+
+        size_t get_bytes() const {
+            size_t bytes = 0;
+            for (const std::vector<Index>& bucket : m_Buckets) {
+                bytes += bucket.capacity() * sizeof(Index);
+            }
+            return bytes;
+        }
+    };
+
+    //############################################################################//
+    // | FLAT INDEX UTILITIES |
+    //############################################################################//
+
+    static constexpr Index flat_offset(const Cardinal dir, const Index cols) {
+        switch (dir) {
+            case Cardinal::NORTH:
+                return -cols;
+            case Cardinal::EAST:
+                return 1;
+            case Cardinal::SOUTH:
+                return cols;
+            case Cardinal::WEST:
+                return -1;
+        }
+        throw std::exception();
+    }
+
+    // Invokes fn(dir, neighbour) for every open, in bounds, neighbour of the flat index
+    template<class Function>
+    static inline void for_each_open(const Maze2D& maze, const Index flat, Function fn) {
+        const Index cols = maze.get_col_count();
+        const Index row  = flat / cols;
+        const Index col  = flat - row * cols;
+        const Cell  cell = maze.get_cell_data()[flat];
+
+        if (is_set<Flag::PATH_NORTH>(cell) && row > 0) fn(Cardinal::NORTH, flat - cols);
+        if (is_set<Flag::PATH_EAST>(cell) && col + 1 < cols) fn(Cardinal::EAST, flat + 1);
+        if (is_set<Flag::PATH_SOUTH>(cell) && row + 1 < maze.get_row_count()) {
+            fn(Cardinal::SOUTH, flat + cols);
+        }
+        if (is_set<Flag::PATH_WEST>(cell) && col > 0) fn(Cardinal::WEST, flat - 1);
+    }
+
+    //############################################################################//
+    // | MAZE SOLVER |
+    //############################################################################//
+
+    // Solvers only ever read the maze; if a canvas is provided the search is visualised through
+    // the colour flags (BLUE: Expanded, GREEN: Frontier, RED: Solution).
+    class AbstractMazeSolver {
+
+    protected:
+        bool               m_IsComplete = false;
+        bool               m_IsInit     = false;
+        bool               m_IsSolved   = false;
+        Index2D            m_Start{ 0, 0 };
+        Index2D            m_Goal{ -1, -1 };
+        Maze2D*            m_Canvas     = nullptr;
+        std::vector<Index> m_Path{};
+        size_t             m_ExpandedCount = 0;
+
+    public:
+        AbstractMazeSolver() = default;
+        virtual ~AbstractMazeSolver() = default;
+
+    public:
+        bool is_initialised() const {
+            return m_IsInit;
+        }
+
+        bool is_complete() const {
+            return m_IsComplete;
+        }
+
+        bool is_solved() const {
+            return m_IsSolved;
+        }
+
+        void set_endpoints(const Index2D start, const Index2D goal) {
+            m_Start = start;
+            m_Goal  = goal;
+        }
+
+        void set_canvas(Maze2D* canvas) {
+            m_Canvas = canvas;
+        }
+
+        Index2D get_start() const {
+            return m_Start;
+        }
+
+        Index2D get_goal() const {
+            return m_Goal;
+        }
+
+        // Flat indices from start to goal (inclusive), empty until solved
+        const std::vector<Index>& get_path() const {
+            return m_Path;
+        }
+
+        size_t get_expanded_count() const {
+            return m_ExpandedCount;
+        }
+
+        // Bytes held by the solver's own search state (excludes the maze)
+        virtual size_t get_state_bytes() const {
+            return m_Path.capacity() * sizeof(Index);
+        }
+
+        void init_once(const Maze2D& maze) {
+            if (!m_IsInit) {
+
+                // Default Goal is the opposite corner
+                if (m_Goal == Index2D{ -1, -1 }) {
+                    m_Goal = Index2D{ maze.get_row_count() - 1, maze.get_col_count() - 1 };
+                }
+
+                maze.check_index(m_Start);
+                maze.check_index(m_Goal);
+                if (m_Canvas != nullptr) {
+                    m_Canvas->unset_flags_all<Flag::RED, Flag::GREEN, Flag::BLUE>();
+                }
+
+                init(maze);
+                m_IsInit = true;
+            }
+        }
+
+        void step(const Maze2D& maze, unsigned int count) {
+            for (unsigned int i = 0; i < count && !m_IsComplete; ++i) step(maze);
+        }
+
+        // Runs the solver to completion (headless)
+        virtual void solve(const Maze2D& maze) {
+            init_once(maze);
+            while (!m_IsComplete) step(maze);
+        }
+
+    public:
+        virtual void init(const Maze2D& maze) = 0;
+        virtual void step(const Maze2D& maze) = 0;
+        virtual std::string get_display_name() = 0;
+
+    protected:
+        void paint(
+                const Index flat,
+                std::initializer_list<Flag> to_unset,
+                std::initializer_list<Flag> to_set
+        ) {
+            if (m_Canvas == nullptr) return;
+            const Index2D pos{ flat / m_Canvas->get_col_count(), flat % m_Canvas->get_col_count() };
+            m_Canvas->unset_flags(pos, to_unset);
+            m_Canvas->set_flags(pos, to_set);
+        }
+
+        // Walks parent directions from the goal back to the start and marks the solver complete
+        void finish_from_parents(const Maze2D& maze, const DirectionPlane& parents) {
+            const Index cols  = maze.get_col_count();
+            const Index start = m_Start.flat(cols);
+            Index       pos   = m_Goal.flat(cols);
+
+            m_Path.clear();
+            m_Path.push_back(pos);
+            while (pos != start) {
+                pos += flat_offset(parents.get(pos), cols);
+                m_Path.push_back(pos);
+            }
+            std::reverse(m_Path.begin(), m_Path.end());
+            finish(true);
+        }
+
+        void finish(bool is_solved) {
+            m_IsComplete = true;
+            m_IsSolved   = is_solved;
+
+            for (const Index flat : m_Path) {
+                paint(flat, { Flag::GREEN, Flag::BLUE }, { Flag::RED });
+            }
+
+            HINFO(
+                    "[SOLVER]",
+                    " # '{}' Finished; Solved: {}, Path: {}, Expanded: {}",
+                    get_display_name(), is_solved, m_Path.size(), m_ExpandedCount
+            );
+        }
+    };
+
+    using MazeSolver = std::unique_ptr<AbstractMazeSolver>;
+
+    //############################################################################//
+    // | BREADTH FIRST SEARCH |
+    //############################################################################//
+
+    class BreadthFirstSolver : public AbstractMazeSolver {
+
+    private:
+        IndexRingBuffer m_Frontier{};
+        CellBitSet      m_Visited{};
+        DirectionPlane  m_Parents{};
+        Index           m_GoalFlat = 0;
+
+    public:
+        virtual void init(const Maze2D& maze) override {
+            const Index start = m_Start.flat(maze.get_col_count());
+            m_GoalFlat = m_Goal.flat(maze.get_col_count());
+
+            m_Visited.resize(maze.get_size());
+            m_Parents.resize(maze.get_size());
+            m_Frontier.clear();
+
+            m_Visited.set(start);
+            m_Frontier.push(start);
+            paint(start, {}, { Flag::GREEN });
+        }
+
+        virtual void step(const Maze2D& maze) override {
+            if (is_complete()) return;
+
+            if (m_Frontier.empty()) {
+                finish(false);
+                return;
+            }
+
+            const Index pos = m_Frontier.pop();
+            ++m_ExpandedCount;
+            paint(pos, { Flag::GREEN }, { Flag::BLUE });
+
+            if (pos == m_GoalFlat) {
+                finish_from_parents(maze, m_Parents);
+                return;
+            }
+
+            for_each_open(maze, pos, [&](const Cardinal dir, const Index next) {
+                if (m_Visited.test_and_set(next)) return;
+                m_Parents.set(next, opposite(dir));
+                m_Frontier.push(next);
+                paint(next, {}, { Flag::GREEN });
+            });
+        }
+
+        virtual size_t get_state_bytes() const override {
+            return AbstractMazeSolver::get_state_bytes()
+                   + m_Frontier.get_bytes()
+                   + m_Visited.get_bytes()
+                   + m_Parents.get_bytes();
+        }
+
+        virtual std::string get_display_name() override {
+            return "Breadth First Search";
+        }
+    };
+
+    //############################################################################//
+    // | DEPTH FIRST SEARCH (ITERATIVE) |
+    //############################################################################//
+
+    class DepthFirstSolver : public AbstractMazeSolver {
+
+    private:
+        std::vector<Index> m_Stack{};
+        CellBitSet         m_Visited{};
+        DirectionPlane     m_Parents{};
+        Index              m_GoalFlat = 0;
+
+    public:
+        virtual void init(const Maze2D& maze) override {
+            const Index start = m_Start.flat(maze.get_col_count());
+            m_GoalFlat = m_Goal.flat(maze.get_col_count());
+
+            m_Visited.resize(maze.get_size());
+            m_Parents.resize(maze.get_size());
+            m_Stack.clear();
+
+            m_Stack.push_back(start);
+            paint(start, {}, { Flag::GREEN });
+        }
+
+        virtual void step(const Maze2D& maze) override {
+            if (is_complete()) return;
+
+            // Cells can be pushed more than once; the last push wins so skip stale entries
+            Index pos = -1;
+            while (!m_Stack.empty()) {
+                pos = m_Stack.back();
+                m_Stack.pop_back();
+                if (!m_Visited.test_and_set(pos)) break;
+                pos = -1;
+            }
+
+            if (pos < 0) {
+                finish(false);
+                return;
+            }
+
+            ++m_ExpandedCount;
+            paint(pos, { Flag::GREEN }, { Flag::BLUE });
+
+            if (pos == m_GoalFlat) {
+                finish_from_parents(maze, m_Parents);
+                return;
+            }
+
+            for_each_open(maze, pos, [&](const Cardinal dir, const Index next) {
+                if (m_Visited.test(next)) return;
+                m_Parents.set(next, opposite(dir));
+                m_Stack.push_back(next);
+                paint(next, {}, { Flag::GREEN });
+            });
+        }
+
+        virtual size_t get_state_bytes() const override {
+            return AbstractMazeSolver::get_state_bytes()
+                   + m_Stack.capacity() * sizeof(Index)
+                   + m_Visited.get_bytes()
+                   + m_Parents.get_bytes();
+        }
+
+        virtual std::string get_display_name() override {
+            return "Depth First Search";
+        }
+    };
+
+    //############################################################################//
+    // | A* SEARCH |
+    //############################################################################//
+
+    struct ManhattanHeuristic {
+        static constexpr uint32_t estimate(const Index2D from, const Index2D to) {
+            return static_cast<uint32_t>(std::abs(from.row - to.row) + std::abs(from.col - to.col));
+        }
+    };
+
+    // A* over unit cost cells. The heuristic is a template parameter so the estimate is inlined
+    // into the expansion loop. A cell is closed once it has a score but is no longer queued, so
+    // no separate closed set is kept.
+    template<class Heuristic = ManhattanHeuristic>
+    class AStarSolver : public AbstractMazeSolver {
+
+    public:
+        inline static constexpr uint32_t s_Unreached = UINT32_MAX;
+
+    private:
+        IndexedMinHeap<4>     m_Open{};
+        std::vector<uint32_t> m_Scores{};
+        DirectionPlane        m_Parents{};
+        Index                 m_GoalFlat = 0;
+
+    public:
+        virtual void init(const Maze2D& maze) override {
+            const Index start = m_Start.flat(maze.get_col_count());
+            m_GoalFlat = m_Goal.flat(maze.get_col_count());
+
+            m_Open.resize(maze.get_size());
+            m_Scores.assign(maze.get_size(), s_Unreached);
+            m_Parents.resize(maze.get_size());
+
+            m_Scores[start] = 0;
+            m_Open.push_or_decrease(start, Heuristic::estimate(m_Start, m_Goal));
+            paint(start, {}, { Flag::GREEN });
+        }
+
+        virtual void step(const Maze2D& maze) override {
+            if (is_complete()) return;
+
+            if (m_Open.empty()) {
+                finish(false);
+                return;
+            }
+
+            const Index pos = m_Open.pop();
+            ++m_ExpandedCount;
+            paint(pos, { Flag::GREEN }, { Flag::BLUE });
+
+            if (pos == m_GoalFlat) {
+                finish_from_parents(maze, m_Parents);
+                return;
+            }
+
+            const Index    cols  = maze.get_col_count();
+            const uint32_t score = m_Scores[pos] + 1;
+            for_each_open(maze, pos, [&](const Cardinal dir, const Index next) {
+                if (score >= m_Scores[next]) return;
+
+                m_Scores[next] = score;
+                m_Parents.set(next, opposite(dir));
+
+                const Index2D next_pos{ next / cols, next - (next / cols) * cols };
+                m_Open.push_or_decrease(next, score + Heuristic::estimate(next_pos, m_Goal));
+                paint(next, {}, { Flag::GREEN });
+            });
+        }
+
+        virtual size_t get_state_bytes() const override {
+            return AbstractMazeSolver::get_state_bytes()
+                   + m_Open.get_bytes()
+                   + m_Scores.capacity() * sizeof(uint32_t)
+                   + m_Parents.get_bytes();
+        }
+
+        virtual std::string get_display_name() override {
+            return "A* Search - Manhattan";
+        }
+    };
+
+    //############################################################################//
+    // | DIJKSTRA (WEIGHTED CELLS) |
+    //############################################################################//
+
+    // Cheapest path where entering a cell costs 'maze.get_cost(cell)'; on a maze without a cost
+    // plane every cell costs one and this is a BFS. Costs fit in a byte so the open set is a
+    // bucket queue (one bucket per key over a 256 key window) with lazy deletion rather than a
+    // comparison heap. Each step settles one cell.
+    class DijkstraSolver : public AbstractMazeSolver {
+
+    public:
+        inline static constexpr uint32_t s_Unreached = UINT32_MAX;
+
+    private:
+        BucketQueue<256>      m_Open{};
+        std::vector<uint32_t> m_Costs{};
+        DirectionPlane        m_Parents{};
+        Index                 m_GoalFlat = 0;
+
+    public:
+        virtual void init(const Maze2D& maze) override {
+            const Index start = m_Start.flat(maze.get_col_count());
+            m_GoalFlat = m_Goal.flat(maze.get_col_count());
+
+            m_Open.clear();
+            m_Costs.assign(maze.get_size(), s_Unreached);
+            m_Parents.resize(maze.get_size());
+
+            m_Costs[start] = 0;
+            m_Open.push(start, 0);
+            paint(start, {}, { Flag::GREEN });
+        }
+
+        virtual void step(const Maze2D& maze) override {
+            if (is_complete()) return;
+
+            // Skip entries made stale by a later, cheaper push; costs are positive so a settled
+            // cell is never pushed again
+            Index pos = -1;
+            while (!m_Open.empty()) {
+                const auto [cost, item] = m_Open.pop();
+                if (cost == m_Costs[item]) {
+                    pos = item;
+                    break;
+                }
+            }
+
+            if (pos == -1) {
+                finish(false);
+                return;
+            }
+
+            ++m_ExpandedCount;
+            paint(pos, { Flag::GREEN }, { Flag::BLUE });
+
+            if (pos == m_GoalFlat) {
+                finish_from_parents(maze, m_Parents);
+                return;
+            }
+
+            const uint8_t* costs = maze.get_cost_data();
+            const uint32_t base  = m_Costs[pos];
+            for_each_open(maze, pos, [&](const Cardinal dir, const Index next) {
+                const uint32_t cost = base + (costs ? costs[next] : Maze2D::s_DefaultCost);
+                if (cost >= m_Costs[next]) return;
+
+                m_Costs[next] = cost;
+                m_Parents.set(next, opposite(dir));
+                m_Open.push(next, cost);
+                paint(next, {}, { Flag::GREEN });
+            });
+        }
+
+        // Headless; the qualified call is not virtual so the step inlines into the loop
+        virtual void solve(const Maze2D& maze) override {
+            init_once(maze);
+            while (!m_IsComplete) DijkstraSolver::step(maze);
+        }
+
+        // Total cost of the path found (excludes the start cell); s_Unreached if unsolved
+        uint32_t get_path_cost() const {
+            return is_solved() ? m_Costs[m_GoalFlat] : s_Unreached;
+        }
+
+        virtual size_t get_state_bytes() const override {
+            return AbstractMazeSolver::get_state_bytes()
+                   + m_Open.get_bytes()
+                   + m_Costs.capacity() * sizeof(uint32_t)
+                   + m_Parents.get_bytes();
+        }
+
+        virtual std::string get_display_name() override {
+            return "Dijkstra - Bucket Queue";
+        }
+    };
+
+    //############################################################################//
+    // | BIDIRECTIONAL BREADTH FIRST SEARCH |
+    //############################################################################//
+
+    // Expands one frontier from the start and one from the goal a whole level at a time, always
+    // growing the side with the smaller frontier. Both sides share a single byte per cell holding
+    // the owning side (bits 0-1), the parent direction (bits 2-3) and the depth modulo 4 (bits
+    // 4-5). Every meeting of the two sides is costed and the cheapest (mu) is kept; the search
+    // stops once the depths of the two levels being expanded sum to at least mu - 1, as no path
+    // found after that point can be shorter. The result is a shortest path in braided mazes too.
+    class BidirectionalSolver : public AbstractMazeSolver {
+
+    protected:
+        inline static constexpr uint8_t  s_StartSide = 1;
+        inline static constexpr uint8_t  s_GoalSide  = 2;
+        inline static constexpr uint8_t  s_SideMask  = 3;
+        inline static constexpr uint32_t s_NoMeeting = UINT32_MAX;
+
+        struct Meeting {
+            Index    start_side = -1;
+            Index    goal_side  = -1;
+            uint32_t cost       = s_NoMeeting;
+        };
+
+    protected:
+        std::vector<uint8_t> m_State{};
+        IndexRingBuffer      m_Frontiers[2];
+        uint32_t             m_Depths[2]{};
+        size_t               m_LevelLeft = 0;
+        Meeting              m_Meeting{};
+        uint8_t              m_Side      = s_StartSide;
+
+    public:
+        virtual void init(const Maze2D& maze) override {
+            const Index start = m_Start.flat(maze.get_col_count());
+            const Index goal  = m_Goal.flat(maze.get_col_count());
+
+            m_State.assign(maze.get_size(), 0);
+            m_Frontiers[0].clear();
+            m_Frontiers[1].clear();
+            m_Depths[0] = 0;
+            m_Depths[1] = 0;
+            m_LevelLeft = 0;
+            m_Meeting   = Meeting{};
+            m_Side      = s_StartSide;
+
+            m_State[start] = s_StartSide;
+            m_Frontiers[0].push(start);
+            paint(start, {}, { Flag::GREEN });
+
+            if (goal == start) {
+                m_Meeting = Meeting{ start, start, 0 };
+                finish_from_meeting(maze);
+                return;
+            }
+
+            m_State[goal] = s_GoalSide;
+            m_Frontiers[1].push(goal);
+            paint(goal, {}, { Flag::GREEN });
+        }
+
+        virtual void step(const Maze2D& maze) override {
+            if (is_complete()) return;
+
+            // Between levels; once either side runs dry every meeting has been seen
+            if (m_LevelLeft == 0) {
+                if (is_meeting_final() || m_Frontiers[0].empty() || m_Frontiers[1].empty()) {
+                    finish_from_meeting(maze);
+                    return;
+                }
+
+                const bool is_start_smaller = m_Frontiers[0].size() <= m_Frontiers[1].size();
+                m_Side      = is_start_smaller ? s_StartSide : s_GoalSide;
+                m_LevelLeft = frontier_of(m_Side).size();
+            }
+
+            // The other side is between levels so it owns nothing deeper than its frontier
+            const uint8_t  side       = m_Side;
+            const uint32_t peer_limit = depth_of(other(side));
+            expand<false>(maze, side, depth_of(side), [&]() { return peer_limit; }, m_Meeting);
+            if (--m_LevelLeft == 0) ++m_Depths[side - 1];
+
+            if (is_meeting_final()) finish_from_meeting(maze);
+        }
+
+        virtual size_t get_state_bytes() const override {
+            return AbstractMazeSolver::get_state_bytes()
+                   + m_State.capacity() * sizeof(uint8_t)
+                   + m_Frontiers[0].get_bytes()
+                   + m_Frontiers[1].get_bytes();
+        }
+
+        virtual std::string get_display_name() override {
+            return "Bidirectional BFS";
+        }
+
+    protected:
+        static constexpr uint8_t other(const uint8_t side) {
+            return side == s_StartSide ? s_GoalSide : s_StartSide;
+        }
+
+        IndexRingBuffer& frontier_of(const uint8_t side) {
+            return m_Frontiers[side - 1];
+        }
+
+        uint32_t depth_of(const uint8_t side) const {
+            return m_Depths[side - 1];
+        }
+
+        // No path left undiscovered can be shorter than one through both unexpanded levels
+        bool is_meeting_final() const {
+            return m_Meeting.cost != s_NoMeeting
+                   && m_Meeting.cost <= m_Depths[0] + m_Depths[1] + 1;
+        }
+
+        // Pops & expands one cell of the level at 'depth'. A neighbour owned by the other side is
+        // a meeting; its depth is recovered from the 2 depth bits given that the other side owns
+        // nothing deeper than peer_limit() once the neighbour has been read. The cheapest meeting
+        // is kept in 'best'.
+        template<bool IsAtomic, class PeerLimit>
+        void expand(
+                const Maze2D& maze,
+                const uint8_t side,
+                const uint32_t depth,
+                PeerLimit peer_limit,
+                Meeting& best
+        ) {
+            IndexRingBuffer& frontier = frontier_of(side);
+            const Index      pos      = frontier.pop();
+
+            if constexpr (!IsAtomic) {
+                ++m_ExpandedCount;
+                paint(pos, { Flag::GREEN }, { Flag::BLUE });
+            }
+
+            for_each_open(maze, pos, [&](const Cardinal dir, const Index next) {
+                const uint8_t parent  = static_cast<uint8_t>(opposite(dir));
+                const uint8_t level   = static_cast<uint8_t>((depth + 1) & 3);
+                const uint8_t desired = side | static_cast<uint8_t>(parent << 2 | level << 4);
+                uint8_t       owner   = 0;
+
+                if constexpr (IsAtomic) {
+                    std::atomic_ref<uint8_t> ref{ m_State[next] };
+                    if (ref.compare_exchange_strong(
+                            owner, desired, std::memory_order_acq_rel, std::memory_order_acquire
+                    )) {
+                        frontier.push(next);
+                        return;
+                    }
+                } else {
+                    owner = m_State[next];
+                    if (owner == 0) {
+                        m_State[next] = desired;
+                        frontier.push(next);
+                        paint(next, {}, { Flag::GREEN });
+                        return;
+                    }
+                }
+
+                if ((owner & s_SideMask) == side) return;
+
+                const uint32_t limit      = peer_limit();
+                const uint32_t peer_depth = limit - ((limit - (owner >> 4)) & 3);
+                const uint32_t cost       = depth + 1 + peer_depth;
+                if (cost >= best.cost) return;
+                const bool is_start = side == s_StartSide;
+                best = is_start ? Meeting{ pos, next, cost } : Meeting{ next, pos, cost };
+            });
+        }
+
+        void finish_from_meeting(const Maze2D& maze) {
+            if (m_Meeting.cost == s_NoMeeting) {
+                finish(false);
+                return;
+            }
+
+            const Index cols = maze.get_col_count();
+            const auto  walk = [&](Index pos, std::vector<Index>& out) {
+                out.push_back(pos);
+                while (!is_root(maze, pos)) {
+                    pos += flat_offset(static_cast<Cardinal>((m_State[pos] >> 2) & 3), cols);
+                    out.push_back(pos);
+                }
+            };
+
+            // Start half is walked backwards, the goal half forwards
+            m_Path.clear();
+            walk(m_Meeting.start_side, m_Path);
+            std::reverse(m_Path.begin(), m_Path.end());
+
+            if (m_Meeting.goal_side != m_Meeting.start_side) {
+                std::vector<Index> goal_half{};
+                walk(m_Meeting.goal_side, goal_half);
+                m_Path.insert(m_Path.end(), goal_half.begin(), goal_half.end());
+            }
+            finish(true);
+        }
+
+    private:
+        bool is_root(const Maze2D& maze, const Index pos) const {
+            const Index cols = maze.get_col_count();
+            return pos == m_Start.flat(cols) || pos == m_Goal.flat(cols);
+        }
+    };
+
+    // Same search, but solve() runs the two frontiers on separate threads, each a level at a time
+    // at its own pace. Cells are claimed with a CAS on the shared state byte so the parent and
+    // depth bits are published with the owning side. Each side publishes the level it expands
+    // before claiming the level below it, which bounds the depth of any cell it is seen to own.
+    class ThreadedBidirectionalSolver : public BidirectionalSolver {
+
+    public:
+        virtual void solve(const Maze2D& maze) override {
+            init_once(maze);
+            if (is_complete()) return;
+
+            // Visualising needs single threaded writes to the canvas
+            if (m_Canvas != nullptr) {
+                BidirectionalSolver::solve(maze);
+                return;
+            }
+
+            Meeting               meetings[2]{};
+            size_t                expanded[2]{};
+            std::atomic<uint32_t> levels[2]{ 0, 0 };
+            std::atomic<uint32_t> best_cost{ s_NoMeeting };
+            std::atomic<bool>     is_done{ false };
+
+            const auto search = [&](const uint8_t side) {
+                IndexRingBuffer&       frontier = frontier_of(side);
+                Meeting&               meeting  = meetings[side - 1];
+                size_t&                count    = expanded[side - 1];
+                std::atomic<uint32_t>& level    = levels[side - 1];
+                std::atomic<uint32_t>& peer     = levels[other(side) - 1];
+
+                const auto peer_limit = [&]() { return peer.load(std::memory_order_acquire) + 1; };
+
+                // A side running dry has met every cell the other side could reach it through
+                for (uint32_t depth = 0; !frontier.empty(); ++depth) {
+                    level.store(depth, std::memory_order_release);
+
+                    for (size_t left = frontier.size(); left > 0; --left) {
+                        if (is_done.load(std::memory_order_relaxed)) return;
+
+                        ++count;
+                        expand<true>(maze, side, depth, peer_limit, meeting);
+
+                        uint32_t best = best_cost.load(std::memory_order_relaxed);
+                        while (meeting.cost < best) {
+                            if (!best_cost.compare_exchange_weak(best, meeting.cost)) continue;
+                            best = meeting.cost;
+                        }
+
+                        if (best <= depth + peer.load(std::memory_order_relaxed) + 1) {
+                            is_done.store(true, std::memory_order_relaxed);
+                            return;
+                        }
+                    }
+                }
+                is_done.store(true, std::memory_order_relaxed);
+            };
+
+            std::thread goal_thread{ search, s_GoalSide };
+            search(s_StartSide);
+            goal_thread.join();
+
+            m_ExpandedCount += expanded[0] + expanded[1];
+            m_Meeting = meetings[0].cost <= meetings[1].cost ? meetings[0] : meetings[1];
+            finish_from_meeting(maze);
+        }
+
+        virtual std::string get_display_name() override {
+            return "Bidirectional BFS - Threaded";
+        }
+    };
+
+    //############################################################################//
+    // | DEAD END FILLING |
+    //############################################################################//
+
+    // Seals cells with a single opening (other than the endpoints) until none remain; what is
+    // left is the solution (perfect maze) or the solution plus its loops. Open neighbour counts
+    // are computed a row at a time in parallel bands, after which a worklist seals one cell per
+    // step so no fixpoint sweep is required.
+    class DeadEndFillingSolver : public AbstractMazeSolver {
+
+    private:
+        std::vector<uint8_t> m_Degrees{};
+        std::vector<Index>   m_Worklist{};
+        CellBitSet           m_Sealed{};
+        DirectionPlane       m_Parents{};
+        Index                m_StartFlat = 0;
+        Index                m_GoalFlat  = 0;
+
+    public:
+        virtual void init(const Maze2D& maze) override {
+            const Index rows = maze.get_row_count();
+            const Index cols = maze.get_col_count();
+            m_StartFlat = m_Start.flat(cols);
+            m_GoalFlat  = m_Goal.flat(cols);
+
+            m_Degrees.resize(maze.get_size());
+            m_Sealed.resize(maze.get_size());
+            m_Worklist.clear();
+
+            std::mutex mutex{};
+            ThreadPool::get_shared().for_each_row_band(maze, [&](Index row_begin, Index row_end) {
+                std::vector<Index> local{};
+
+                for (Index row = row_begin; row < row_end; ++row) {
+                    const Cell* cells   = maze.get_cell_data() + static_cast<size_t>(row) * cols;
+                    uint8_t*    degrees = m_Degrees.data() + static_cast<size_t>(row) * cols;
+
+                    // Straight line popcount over the row; vectorised by the compiler
+                    for (Index col = 0; col < cols; ++col) {
+                        const Cell paths = (cells[col] >> 1) & 0xFU;
+                        degrees[col] = static_cast<uint8_t>(std::popcount(paths));
+                    }
+
+                    // Openings leading out of the grid are not neighbours
+                    if (row == 0 || row + 1 == rows) {
+                        const Flag edge = row == 0 ? Flag::PATH_NORTH : Flag::PATH_SOUTH;
+                        for (Index col = 0; col < cols; ++col) {
+                            degrees[col] -= is_set(edge, cells[col]);
+                        }
+                        if (rows == 1) {
+                            for (Index col = 0; col < cols; ++col) {
+                                degrees[col] -= is_set<Flag::PATH_SOUTH>(cells[col]);
+                            }
+                        }
+                    }
+                    degrees[0] -= is_set<Flag::PATH_WEST>(cells[0]);
+                    degrees[cols - 1] -= is_set<Flag::PATH_EAST>(cells[cols - 1]);
+
+                    for (Index col = 0; col < cols; ++col) {
+                        const Index flat = row * cols + col;
+                        if (degrees[col] <= 1 && !is_endpoint(flat)) local.push_back(flat);
+                    }
+                }
+
+                std::lock_guard lock{ mutex };
+                m_Worklist.insert(m_Worklist.end(), local.begin(), local.end());
+            }, 16);
+
+            for (const Index flat : m_Worklist) paint(flat, {}, { Flag::GREEN });
+        }
+
+        virtual void step(const Maze2D& maze) override {
+            if (is_complete()) return;
+
+            if (m_Worklist.empty()) {
+                extract_path(maze);
+                return;
+            }
+
+            const Index pos = m_Worklist.back();
+            m_Worklist.pop_back();
+            if (m_Sealed.test_and_set(pos)) return;
+
+            ++m_ExpandedCount;
+            paint(pos, { Flag::GREEN }, { Flag::BLUE });
+
+            for_each_open(maze, pos, [&](Cardinal, const Index next) {
+                if (m_Sealed.test(next)) return;
+                if (--m_Degrees[next] == 1 && !is_endpoint(next)) {
+                    m_Worklist.push_back(next);
+                    paint(next, {}, { Flag::GREEN });
+                }
+            });
+        }
+
+        virtual size_t get_state_bytes() const override {
+            return AbstractMazeSolver::get_state_bytes()
+                   + m_Degrees.capacity()
+                   + m_Worklist.capacity() * sizeof(Index)
+                   + m_Sealed.get_bytes()
+                   + m_Parents.get_bytes();
+        }
+
+        virtual std::string get_display_name() override {
+            return "Dead End Filling";
+        }
+
+    private:
+        bool is_endpoint(const Index flat) const {
+            return flat == m_StartFlat || flat == m_GoalFlat;
+        }
+
+        // Only unsealed cells remain; for perfect mazes this is exactly the solution
+        void extract_path(const Maze2D& maze) {
+            m_Parents.resize(maze.get_size());
+            m_Worklist.push_back(m_StartFlat);
+            m_Sealed.set(m_StartFlat);
+
+            for (size_t head = 0; head < m_Worklist.size(); ++head) {
+                const Index pos = m_Worklist[head];
+                if (pos == m_GoalFlat) {
+                    m_Worklist.clear();
+                    finish_from_parents(maze, m_Parents);
+                    return;
+                }
+
+                for_each_open(maze, pos, [&](const Cardinal dir, const Index next) {
+                    if (m_Sealed.test_and_set(next)) return;
+                    m_Parents.set(next, opposite(dir));
+                    m_Worklist.push_back(next);
+                });
+            }
+
+            m_Worklist.clear();
+            finish(false);
+        }
+    };
+
+    //############################################################################//
+    // | ALL SOLVERS IN A CONTAINER |
+    //############################################################################//
+
+    template<class T>
+    inline static constexpr auto make_solver() {
+        static_assert(std::is_base_of<AbstractMazeSolver, T>(), "T must derive Abstract Maze Solver...");
+        return std::make_unique<T>();
+    }
+
+    inline static const std::array<std::function<MazeSolver()>, 7> s_MazeSolverFactories{
+            make_solver<BreadthFirstSolver>,
+            make_solver<DepthFirstSolver>,
+            make_solver<AStarSolver<ManhattanHeuristic>>,
+            make_solver<BidirectionalSolver>,
+            make_solver<ThreadedBidirectionalSolver>,
+            make_solver<DeadEndFillingSolver>,
+            make_solver<DijkstraSolver>
+    };
+
+    inline static MazeSolver get_maze_solver(size_t index) {
+        ASSERT(index < s_MazeSolverFactories.size(), "Index provided is out of bounds...");
+        return s_MazeSolverFactories[index]();
+    }
+
+} // maze
+
+#endif
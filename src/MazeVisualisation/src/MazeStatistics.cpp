@@ -0,0 +1,202 @@
+//
+// Header File: MazeStatistics.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeStatistics.h"
+
+namespace maze {
+
+    //############################################################################//
+    // | JSON |
+    //############################################################################//
+
+    template<class Container>
+    static std::string json_array(const Container& values) {
+        std::string out{ "[" };
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (i != 0) out.append(",");
+            out.append(std::format("{}", values[i]));
+        }
+        return out.append("]");
+    }
+
+    static std::string json_index(const Index2D pos) {
+        return std::format("[{},{}]", pos.row, pos.col);
+    }
+
+    static std::string json_distance(const uint32_t distance) {
+        return distance == s_Unreachable ? std::string{ "null" } : std::format("{}", distance);
+    }
+
+    // One line per maze so batches can be written as JSON lines
+    std::string MazeStatistics::to_json() const {
+        return std::format(
+                "{{\"rows\":{},\"cols\":{},\"cells\":{},"
+                "\"dead_ends\":{},\"dead_end_ratio\":{:.6f},\"junctions\":{},"
+                "\"degree_histogram\":{},"
+                "\"corridors\":{{\"count\":{},\"mean_length\":{:.4f},\"max_length\":{},"
+                "\"histogram\":{}}},"
+                "\"river_factor\":{:.6f},"
+                "\"solution\":{{\"start\":{},\"goal\":{},\"length\":{}}},"
+                "\"diameter\":{{\"length\":{},\"from\":{},\"to\":{}}}}}",
+                bounds.row, bounds.col, get_cell_count(),
+                get_dead_end_count(), get_dead_end_ratio(), get_junction_count(),
+                json_array(degree_histogram),
+                corridor_count, get_mean_corridor_length(), corridor_length_max,
+                json_array(corridor_histogram),
+                get_river_factor(),
+                json_index(start), json_index(goal), json_distance(solution_length),
+                json_distance(diameter), json_index(diameter_from), json_index(diameter_to)
+        );
+    }
+
+    //############################################################################//
+    // | MAZE ANALYSER |
+    //############################################################################//
+
+    MazeAnalyser::MazeAnalyser(
+            ThreadPool& pool
+    ) : m_Pool(pool),
+        m_Bfs(pool),
+        m_Distances(),
+        m_MergeMutex() {
+    }
+
+    // Sides (bit i is Cardinal i) which are open & lead to a cell inside the maze
+    static uint32_t open_sides(
+            const Cell cell,
+            const Index row,
+            const Index col,
+            const Index2D bounds
+    ) {
+        uint32_t sides = (cell >> 1) & 0xFU;
+        if (row == 0) sides &= ~(1U << static_cast<uint32_t>(Cardinal::NORTH));
+        if (col + 1 == bounds.col) sides &= ~(1U << static_cast<uint32_t>(Cardinal::EAST));
+        if (row + 1 == bounds.row) sides &= ~(1U << static_cast<uint32_t>(Cardinal::SOUTH));
+        if (col == 0) sides &= ~(1U << static_cast<uint32_t>(Cardinal::WEST));
+        return sides;
+    }
+
+    MazeStatistics MazeAnalyser::analyse(
+            const Maze2D& maze,
+            const Index2D start,
+            const Index2D goal
+    ) {
+        maze.check_index(start);
+        maze.check_index(goal);
+
+        MazeStatistics stats{};
+        stats.bounds = maze.get_bounds();
+        stats.start  = start;
+        stats.goal   = goal;
+
+        m_Pool.for_each_row_band(maze, [&](const Index row_begin, const Index row_end) {
+            count_band(maze, row_begin, row_end, stats);
+        }, 16);
+
+        // Double BFS; the first sweep also gives the solution length
+        const Index cols = maze.get_col_count();
+        m_Bfs.compute(maze, start, m_Distances);
+        stats.solution_length = m_Distances[goal.flat(cols)];
+
+        const Index from = find_farthest().first;
+        m_Bfs.compute(maze, Index2D{ from / cols, from % cols }, m_Distances);
+
+        const auto [to, diameter] = find_farthest();
+        stats.diameter      = diameter;
+        stats.diameter_from = Index2D{ from / cols, from % cols };
+        stats.diameter_to   = Index2D{ to / cols, to % cols };
+        return stats;
+    }
+
+    void MazeAnalyser::count_band(
+            const Maze2D& maze,
+            const Index row_begin,
+            const Index row_end,
+            MazeStatistics& out
+    ) {
+        const Cell*    data   = maze.get_cell_data();
+        const Index2D  bounds = maze.get_bounds();
+        const Index    cols   = bounds.col;
+        const size_t   limit  = maze.get_size();
+        MazeStatistics local{};
+
+        for (Index row = row_begin; row < row_end; ++row) {
+            for (Index col = 0; col < cols; ++col) {
+                const Index    flat   = row * cols + col;
+                const uint32_t sides  = open_sides(data[flat], row, col, bounds);
+                const int      degree = std::popcount(sides);
+                ++local.degree_histogram[degree];
+                if (degree == 0 || degree == 2) continue;
+
+                // Walk each corridor leaving this cell until it reaches a cell which is not
+                // a plain corridor cell; the length limit only matters for inconsistent walls.
+                // Rings made only of corridor cells have no ends and are not counted.
+                for (uint32_t remaining = sides; remaining != 0; remaining &= remaining - 1) {
+                    const Cardinal leave  = static_cast<Cardinal>(std::countr_zero(remaining));
+                    Cardinal       travel = leave;
+                    Index          pos    = flat + flat_offset(leave, cols);
+                    size_t         length = 1;
+
+                    while (length <= limit) {
+                        const uint32_t next = open_sides(data[pos], pos / cols, pos % cols, bounds);
+                        if (std::popcount(next) != 2) break;
+
+                        const uint32_t back = 1U << static_cast<uint32_t>(opposite(travel));
+                        travel = static_cast<Cardinal>(std::countr_zero(next & ~back));
+                        pos += flat_offset(travel, cols);
+                        ++length;
+                    }
+
+                    // Seen from both ends; a loop back to the same cell is told apart by side
+                    const Cardinal entered = opposite(travel);
+                    if (flat > pos || (flat == pos && leave >= entered)) continue;
+
+                    ++local.corridor_count;
+                    local.corridor_length_total += length;
+                    local.corridor_length_max = std::max(local.corridor_length_max, length);
+                    ++local.corridor_histogram[std::min(length, s_CorridorBuckets - 1)];
+                }
+            }
+        }
+
+        std::lock_guard lock{ m_MergeMutex };
+        for (size_t i = 0; i < out.degree_histogram.size(); ++i) {
+            out.degree_histogram[i] += local.degree_histogram[i];
+        }
+        for (size_t i = 0; i < s_CorridorBuckets; ++i) {
+            out.corridor_histogram[i] += local.corridor_histogram[i];
+        }
+        out.corridor_count += local.corridor_count;
+        out.corridor_length_total += local.corridor_length_total;
+        out.corridor_length_max = std::max(out.corridor_length_max, local.corridor_length_max);
+    }
+
+    std::pair<Index, uint32_t> MazeAnalyser::find_farthest() {
+        std::pair<Index, uint32_t> best{ -1, 0 };
+
+        // The source itself (distance 0) is always reachable so there is always an answer
+        m_Pool.parallel_for(m_Distances.size(), [&](const size_t begin, const size_t end) {
+            std::pair<Index, uint32_t> local{ -1, 0 };
+            for (size_t i = begin; i < end; ++i) {
+                const uint32_t distance = m_Distances[i];
+                if (distance != s_Unreachable && (local.first < 0 || distance > local.second)) {
+                    local = { static_cast<Index>(i), distance };
+                }
+            }
+            if (local.first < 0) return;
+
+            std::lock_guard lock{ m_MergeMutex };
+            if (best.first < 0
+                || local.second > best.second
+                || (local.second == best.second && local.first < best.first)) {
+                best = local;
+            }
+        }, 1 << 16);
+        return best;
+    }
+
+} // maze
@@ -0,0 +1,110 @@
+//
+// Header File: MazeStatistics.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZESTATISTICS_H
+#define MAZEVISUALISATION_MAZESTATISTICS_H
+
+#include "MazeConstructs.h"
+#include "MazeDistanceField.h"
+#include "MazeParallel.h"
+
+#include <array>
+#include <mutex>
+
+namespace maze {
+
+    //############################################################################//
+    // | MAZE STATISTICS |
+    //############################################################################//
+
+    // Corridor histogram buckets by length; the last holds every corridor at least that long
+    inline static constexpr size_t s_CorridorBuckets = 64;
+
+    // Degree is the number of in bounds openings of a cell: 1 is a dead end, 3+ a junction. A
+    // corridor is a maximal run of degree 2 cells between two other cells; its length is the
+    // number of passages walked from one end to the other.
+    struct MazeStatistics {
+        Index2D                                 bounds;
+        Index2D                                 start;
+        Index2D                                 goal;
+        std::array<size_t, s_CardinalCount + 1> degree_histogram;
+        std::array<size_t, s_CorridorBuckets>   corridor_histogram;
+        size_t                                  corridor_count;
+        size_t                                  corridor_length_total;
+        size_t                                  corridor_length_max;
+        uint32_t                                solution_length;
+        uint32_t                                diameter;
+        Index2D                                 diameter_from;
+        Index2D                                 diameter_to;
+
+        size_t get_cell_count() const {
+            return bounds.size();
+        }
+
+        size_t get_dead_end_count() const {
+            return degree_histogram[1];
+        }
+
+        size_t get_junction_count() const {
+            return degree_histogram[3] + degree_histogram[4];
+        }
+
+        double get_dead_end_ratio() const {
+            return static_cast<double>(get_dead_end_count()) / get_cell_count();
+        }
+
+        double get_mean_corridor_length() const {
+            if (corridor_count == 0) return 0.0;
+            return static_cast<double>(corridor_length_total) / corridor_count;
+        }
+
+        // Share of cells which only lead onwards (degree 2); mazes with few, long dead ends
+        // "flow" like a river & score high, mazes with many short spurs score low
+        double get_river_factor() const {
+            return static_cast<double>(degree_histogram[2]) / get_cell_count();
+        }
+
+        std::string to_json() const;
+    };
+
+    //############################################################################//
+    // | MAZE ANALYSER |
+    //############################################################################//
+
+    // Degree & corridor counts are gathered over row bands in parallel; corridors are walked
+    // from their ends so each is seen twice & counted once. The solution length & the first
+    // sweep of the double BFS share a search from the start; the farthest cell from it is the
+    // start of the second sweep whose farthest distance is the diameter (exact for perfect
+    // mazes, a lower bound once there are loops). Buffers are kept between calls.
+    class MazeAnalyser {
+
+    private:
+        ThreadPool&            m_Pool;
+        DirectionOptimisingBfs m_Bfs;
+        DistanceField          m_Distances;
+        std::mutex             m_MergeMutex;
+
+    public:
+        explicit MazeAnalyser(ThreadPool& pool = ThreadPool::get_shared());
+
+    public:
+        MazeStatistics analyse(const Maze2D& maze, Index2D start, Index2D goal);
+
+        MazeStatistics analyse(const Maze2D& maze) {
+            return analyse(maze, Index2D{ 0, 0 }, maze.get_bounds() - Index2D{ 1, 1 });
+        }
+
+    private:
+        void count_band(const Maze2D& maze, Index row_begin, Index row_end, MazeStatistics& out);
+
+        // Farthest reachable cell in the current distance field (lowest index on ties)
+        std::pair<Index, uint32_t> find_farthest();
+    };
+
+} // maze
+
+#endif
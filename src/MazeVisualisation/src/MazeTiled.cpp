@@ -0,0 +1,317 @@
+//
+// Header File: MazeTiled.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeTiled.h"
+
+#include <filesystem>
+
+namespace maze {
+
+    //############################################################################//
+    // | TILED MAZE |
+    //############################################################################//
+
+    static Cell open_side(const Cell cell, const Cardinal dir) {
+        return (cell & ~cellof<Flag::EMPTY_PATH>()) | cellof(path_flag_for_dir(dir));
+    }
+
+    TiledMaze2D::TiledMaze2D(
+            const std::string& path,
+            const Index2D bounds,
+            const Index tile_size,
+            const size_t budget,
+            const MazeFileInfo& info
+    ) : m_Stream(),
+        m_Path(path),
+        m_Bounds(bounds),
+        m_TileSize(tile_size),
+        m_TileGrid{ 0, 0 },
+        m_PayloadOffset(0),
+        m_Written(),
+        m_Tiles(budget),
+        m_LastKey(UINT64_MAX),
+        m_LastTile(nullptr),
+        m_TileReads(0),
+        m_TileWrites(0) {
+
+        if (bounds.row <= 0 || bounds.col <= 0) {
+            HERR("[TILED_MAZE]", " # Invalid size '{}'...", bounds.to_string());
+            throw std::exception();
+        }
+
+        const MazeFileHeader header = make_maze_file_header(bounds, MazeLayout::CELLS, info);
+        {
+            std::ofstream out{ path, std::ios::binary | std::ios::trunc };
+            out.write(reinterpret_cast<const char*>(&header), sizeof(MazeFileHeader));
+            if (!out) {
+                HERR("[TILED_MAZE]", " # Failed to create '{}'...", path);
+                throw std::exception();
+            }
+        }
+
+        // Sparse where the file system allows it; untouched tiles never reach the disk
+        std::error_code error{};
+        std::filesystem::resize_file(path, header.payload_offset + header.payload_bytes, error);
+        if (error) {
+            HERR("[TILED_MAZE]", " # Failed to size '{}' to {} bytes; {}",
+                 path, header.payload_offset + header.payload_bytes, error.message());
+            throw std::exception();
+        }
+
+        m_PayloadOffset = header.payload_offset;
+        init_tiles(false);
+    }
+
+    TiledMaze2D::TiledMaze2D(
+            const std::string& path,
+            const Index tile_size,
+            const size_t budget
+    ) : m_Stream(),
+        m_Path(path),
+        m_Bounds{ 0, 0 },
+        m_TileSize(tile_size),
+        m_TileGrid{ 0, 0 },
+        m_PayloadOffset(0),
+        m_Written(),
+        m_Tiles(budget),
+        m_LastKey(UINT64_MAX),
+        m_LastTile(nullptr),
+        m_TileReads(0),
+        m_TileWrites(0) {
+
+        const MazeFileHeader header = read_maze_file_header(path);
+        if (static_cast<MazeLayout>(header.layout) != MazeLayout::CELLS) {
+            HERR("[TILED_MAZE]", " # '{}' has layout {}; only CELLS files can be paged...",
+                 path, header.layout);
+            throw std::exception();
+        }
+
+        m_Bounds        = Index2D{ header.rows, header.cols };
+        m_PayloadOffset = header.payload_offset;
+        init_tiles(true);
+    }
+
+    TiledMaze2D::~TiledMaze2D() {
+        try {
+            flush();
+        } catch (const std::exception&) {
+            // Already logged
+        }
+    }
+
+    void TiledMaze2D::init_tiles(const bool is_written) {
+        if (m_TileSize <= 0) {
+            HERR("[TILED_MAZE]", " # Invalid tile size {}...", m_TileSize);
+            throw std::exception();
+        }
+
+        m_TileGrid = Index2D{
+                (m_Bounds.row + m_TileSize - 1) / m_TileSize,
+                (m_Bounds.col + m_TileSize - 1) / m_TileSize
+        };
+        m_Written.assign(m_TileGrid.size(), is_written);
+
+        m_Stream.open(m_Path, std::ios::binary | std::ios::in | std::ios::out);
+        if (!m_Stream) {
+            HERR("[TILED_MAZE]", " # Failed to open '{}'...", m_Path);
+            throw std::exception();
+        }
+
+        m_Tiles.set_on_evict([this](const uint64_t& key, Tile& tile) { store_tile(key, tile); });
+    }
+
+    void TiledMaze2D::make_path(const Index2D pos, const Cardinal dir) {
+        const Index2D to = pos + cardinal_offset(dir);
+        check_index(pos);
+        check_index(to);
+
+        // One cell at a time; loading the second tile may evict the first
+        Cell& from = tile_of(pos, true).cells[offset_in_tile(pos)];
+        from = open_side(from, dir);
+
+        Cell& other = tile_of(to, true).cells[offset_in_tile(to)];
+        other = open_side(other, opposite(dir));
+    }
+
+    Cell* TiledMaze2D::get_tile_data(const Index2D tile) {
+        if (!tile.inbounds(m_TileGrid)) {
+            HERR("[TILED_MAZE]", " # Tile '{}' is out of bounds for '{}'...",
+                 tile.to_string(), m_TileGrid.to_string());
+            throw std::exception();
+        }
+        return tile_of(Index2D{ tile.row * m_TileSize, tile.col * m_TileSize }, true).cells.data();
+    }
+
+    void TiledMaze2D::flush() {
+        m_Tiles.for_each([this](const uint64_t key, Tile& tile) { store_tile(key, tile); });
+        m_Stream.flush();
+        if (!m_Stream) {
+            HERR("[TILED_MAZE]", " # Failed flushing '{}'...", m_Path);
+            throw std::exception();
+        }
+    }
+
+    //############################################################################//
+    // | TILE IO |
+    //############################################################################//
+
+    void TiledMaze2D::load_tile(const uint64_t key) {
+        if (Tile* cached = m_Tiles.find(key); cached != nullptr) {
+            m_LastKey  = key;
+            m_LastTile = cached;
+            return;
+        }
+
+        const size_t cells = static_cast<size_t>(m_TileSize) * m_TileSize;
+        Tile         tile{ std::vector<Cell>(cells, cellof<Flag::EMPTY_PATH>()), false };
+
+        if (m_Written[key]) {
+            const Index row_begin = static_cast<Index>(key / m_TileGrid.col) * m_TileSize;
+            const Index col_begin = static_cast<Index>(key % m_TileGrid.col) * m_TileSize;
+            const Index height    = std::min(m_TileSize, m_Bounds.row - row_begin);
+            const Index width     = std::min(m_TileSize, m_Bounds.col - col_begin);
+
+            for (Index row = 0; row < height; ++row) {
+                const uint64_t flat = static_cast<uint64_t>(row_begin + row) * m_Bounds.col
+                                      + col_begin;
+                m_Stream.seekg(static_cast<std::streamoff>(m_PayloadOffset + flat * sizeof(Cell)));
+                m_Stream.read(reinterpret_cast<char*>(tile.cells.data() + row * m_TileSize),
+                              static_cast<std::streamsize>(width * sizeof(Cell)));
+            }
+
+            if (!m_Stream) {
+                HERR("[TILED_MAZE]", " # Failed to read tile {} of '{}'...", key, m_Path);
+                throw std::exception();
+            }
+            ++m_TileReads;
+        }
+
+        // May evict (& write back) other tiles, never this one
+        m_LastTile = &m_Tiles.put(key, std::move(tile), cells * sizeof(Cell));
+        m_LastKey  = key;
+    }
+
+    void TiledMaze2D::store_tile(const uint64_t key, Tile& tile) {
+        if (!tile.is_dirty) return;
+
+        const Index row_begin = static_cast<Index>(key / m_TileGrid.col) * m_TileSize;
+        const Index col_begin = static_cast<Index>(key % m_TileGrid.col) * m_TileSize;
+        const Index height    = std::min(m_TileSize, m_Bounds.row - row_begin);
+        const Index width     = std::min(m_TileSize, m_Bounds.col - col_begin);
+
+        for (Index row = 0; row < height; ++row) {
+            const uint64_t flat = static_cast<uint64_t>(row_begin + row) * m_Bounds.col + col_begin;
+            m_Stream.seekp(static_cast<std::streamoff>(m_PayloadOffset + flat * sizeof(Cell)));
+            m_Stream.write(reinterpret_cast<const char*>(tile.cells.data() + row * m_TileSize),
+                           static_cast<std::streamsize>(width * sizeof(Cell)));
+        }
+
+        if (!m_Stream) {
+            HERR("[TILED_MAZE]", " # Failed to write tile {} of '{}'...", key, m_Path);
+            throw std::exception();
+        }
+
+        m_Written[key] = true;
+        tile.is_dirty  = false;
+        ++m_TileWrites;
+    }
+
+    //############################################################################//
+    // | TILE ORDER GENERATOR |
+    //############################################################################//
+
+    TileOrderGenerator::TileOrderGenerator(
+            const uint64_t seed
+    ) : m_Seed(seed),
+        m_Counter(0),
+        m_NextTile{ 0, 0 },
+        m_Visited(),
+        m_Stack() {
+    }
+
+    void TileOrderGenerator::reset() {
+        m_Counter  = 0;
+        m_NextTile = Index2D{ 0, 0 };
+        m_Stack.clear();
+    }
+
+    void TileOrderGenerator::step(TiledMaze2D& maze, const size_t tiles) {
+        const Index2D grid = maze.get_tile_grid();
+        for (size_t i = 0; i < tiles && !is_complete(maze); ++i) {
+            carve_tile(maze, m_NextTile);
+            join_tile(maze, m_NextTile);
+
+            if (++m_NextTile.col == grid.col) {
+                m_NextTile.col = 0;
+                ++m_NextTile.row;
+            }
+        }
+    }
+
+    void TileOrderGenerator::carve_tile(TiledMaze2D& maze, const Index2D tile) {
+        const Index size   = maze.get_tile_size();
+        const Index height = std::min(size, maze.get_row_count() - tile.row * size);
+        const Index width  = std::min(size, maze.get_col_count() - tile.col * size);
+
+        // Nothing else is touched while carving so the tile stays resident
+        Cell* cells = maze.get_tile_data(tile);
+        m_Visited.assign(static_cast<size_t>(size) * size, false);
+        m_Stack.clear();
+
+        const Index start_row = static_cast<Index>(next_random() % height);
+        const Index start_col = static_cast<Index>(next_random() % width);
+        m_Stack.push_back(start_row * size + start_col);
+        m_Visited[m_Stack.back()] = true;
+
+        std::array<Cardinal, s_CardinalCount> choices{};
+        while (!m_Stack.empty()) {
+            const Index cell = m_Stack.back();
+            const Index row  = cell / size;
+            const Index col  = cell % size;
+
+            size_t count = 0;
+            for (const Cardinal dir : s_AllCardinals) {
+                const Index2D next = Index2D{ row, col } + cardinal_offset(dir);
+                if (!next.inbounds(Index2D{ height, width })) continue;
+                if (!m_Visited[next.row * size + next.col]) choices[count++] = dir;
+            }
+
+            if (count == 0) {
+                m_Stack.pop_back();
+                continue;
+            }
+
+            const Cardinal dir  = choices[next_random() % count];
+            const Index2D  next = Index2D{ row, col } + cardinal_offset(dir);
+            const Index    flat = next.row * size + next.col;
+
+            cells[cell] = open_side(cells[cell], dir);
+            cells[flat] = open_side(cells[flat], opposite(dir));
+            m_Visited[flat] = true;
+            m_Stack.push_back(flat);
+        }
+    }
+
+    void TileOrderGenerator::join_tile(TiledMaze2D& maze, const Index2D tile) {
+        if (tile.row == 0 && tile.col == 0) return;
+
+        const Index   size   = maze.get_tile_size();
+        const Index2D origin{ tile.row * size, tile.col * size };
+        const Index   height = std::min(size, maze.get_row_count() - origin.row);
+        const Index   width  = std::min(size, maze.get_col_count() - origin.col);
+
+        const bool is_west = tile.row == 0 || (tile.col > 0 && (next_random() & 1U) != 0);
+        if (is_west) {
+            const Index row = origin.row + static_cast<Index>(next_random() % height);
+            maze.make_path(Index2D{ row, origin.col }, Cardinal::WEST);
+        } else {
+            const Index col = origin.col + static_cast<Index>(next_random() % width);
+            maze.make_path(Index2D{ origin.row, col }, Cardinal::NORTH);
+        }
+    }
+
+} // maze
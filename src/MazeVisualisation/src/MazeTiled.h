@@ -0,0 +1,247 @@
+//
+// Header File: MazeTiled.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZETILED_H
+#define MAZEVISUALISATION_MAZETILED_H
+
+#include "MazeConstructs.h"
+#include "MazeFile.h"
+#include "LruCache.h"
+
+#include <fstream>
+#include <string>
+
+namespace maze {
+
+    //############################################################################//
+    // | TILED MAZE |
+    //############################################################################//
+
+    // Maze kept in a CELLS maze file (see MazeFile.h) and paged through square tiles, for mazes
+    // larger than memory. Only the tiles in an LRU bounded by a byte budget are resident; a
+    // changed tile is written back when it is evicted or on 'flush', so a writer that stays
+    // within a few tiles costs one read & one write per tile. Flat offsets are 64 bit.
+    //
+    // A new file is created sparse and tiles never written read back as EMPTY_PATH without
+    // touching the disk. Cells are returned by value because a tile may be evicted by the next
+    // access. Neither the wall hash nor listeners of Maze2D are kept. Not thread-safe.
+    class TiledMaze2D {
+
+    public:
+        inline static constexpr Index  s_DefaultTileSize = 256;
+        inline static constexpr size_t s_DefaultBudget   = 256 * 1024 * 1024;
+
+    private:
+        struct Tile {
+            std::vector<Cell> cells;
+            bool              is_dirty;
+        };
+
+        using TileCache = LruCache<uint64_t, Tile>;
+
+    private:
+        std::fstream      m_Stream;
+        std::string       m_Path;
+        Index2D           m_Bounds;
+        Index             m_TileSize;
+        Index2D           m_TileGrid;
+        uint64_t          m_PayloadOffset;
+        std::vector<bool> m_Written;
+        TileCache         m_Tiles;
+        uint64_t          m_LastKey;
+        Tile*             m_LastTile;
+        size_t            m_TileReads;
+        size_t            m_TileWrites;
+
+    public:
+        // Creates (or truncates) the file for an empty maze of 'bounds'
+        TiledMaze2D(
+                const std::string& path,
+                Index2D bounds,
+                Index tile_size = s_DefaultTileSize,
+                size_t budget = s_DefaultBudget,
+                const MazeFileInfo& info = {}
+        );
+
+        // Opens an existing CELLS maze file
+        explicit TiledMaze2D(
+                const std::string& path,
+                Index tile_size = s_DefaultTileSize,
+                size_t budget = s_DefaultBudget
+        );
+
+        // Writes back dirty tiles; errors are only logged, call 'flush' first to see them
+        ~TiledMaze2D();
+
+        TiledMaze2D(const TiledMaze2D&) = delete;
+        TiledMaze2D& operator =(const TiledMaze2D&) = delete;
+
+        //############################################################################//
+        // | GETTERS |
+        //############################################################################//
+
+    public:
+        Index2D get_bounds() const {
+            return m_Bounds;
+        }
+
+        Index get_row_count() const {
+            return m_Bounds.row;
+        }
+
+        Index get_col_count() const {
+            return m_Bounds.col;
+        }
+
+        uint64_t get_size() const {
+            return m_Bounds.size();
+        }
+
+        Index get_tile_size() const {
+            return m_TileSize;
+        }
+
+        // Tiles down & across
+        Index2D get_tile_grid() const {
+            return m_TileGrid;
+        }
+
+        bool inbounds(const Index2D pos) const {
+            return pos.inbounds(m_Bounds);
+        }
+
+        bool inbounds(const Index2D pos, const Cardinal dir) const {
+            return (pos + cardinal_offset(dir)).inbounds(m_Bounds);
+        }
+
+        Cell get_cell(const Index2D pos) {
+            check_index(pos);
+            return tile_of(pos, false).cells[offset_in_tile(pos)];
+        }
+
+        size_t get_tile_reads() const {
+            return m_TileReads;
+        }
+
+        size_t get_tile_writes() const {
+            return m_TileWrites;
+        }
+
+        size_t get_state_bytes() const {
+            return m_Tiles.get_total_cost() + m_Written.capacity() / 8;
+        }
+
+        //############################################################################//
+        // | WRITES |
+        //############################################################################//
+
+    public:
+        void set_flags(const Index2D pos, std::initializer_list<Flag> flags) {
+            check_index(pos);
+            Cell& cell = tile_of(pos, true).cells[offset_in_tile(pos)];
+            for (const Flag flag : flags) cell |= cellof(flag);
+        }
+
+        void unset_flags(const Index2D pos, std::initializer_list<Flag> flags) {
+            check_index(pos);
+            Cell& cell = tile_of(pos, true).cells[offset_in_tile(pos)];
+            for (const Flag flag : flags) cell &= ~cellof(flag);
+        }
+
+        // Opens the wall between 'pos' & its neighbour; the two may be in different tiles
+        void make_path(Index2D pos, Cardinal dir);
+
+        // Row major cells of a tile with 'get_tile_size' as the stride, marked as changed. Only
+        // valid until the next access to another tile; cells outside the maze are ignored.
+        Cell* get_tile_data(Index2D tile);
+
+        // Writes back every dirty tile; they stay cached
+        void flush();
+
+        //############################################################################//
+        // | UTILITY |
+        //############################################################################//
+
+    private:
+        uint64_t tile_key(const Index2D pos) const {
+            const auto row = static_cast<uint64_t>(pos.row / m_TileSize);
+            const auto col = static_cast<uint64_t>(pos.col / m_TileSize);
+            return row * static_cast<uint64_t>(m_TileGrid.col) + col;
+        }
+
+        size_t offset_in_tile(const Index2D pos) const {
+            return static_cast<size_t>(pos.row % m_TileSize) * m_TileSize + pos.col % m_TileSize;
+        }
+
+        Tile& tile_of(const Index2D pos, const bool is_write) {
+            const uint64_t key = tile_key(pos);
+            if (key != m_LastKey) load_tile(key);
+            m_LastTile->is_dirty |= is_write;
+            return *m_LastTile;
+        }
+
+        void init_tiles(bool is_written);
+        void load_tile(uint64_t key);
+        void store_tile(uint64_t key, Tile& tile);
+
+        void check_index(const Index2D pos) const {
+            if (!inbounds(pos)) {
+                HERR("[TILED_MAZE]", " # Index '{}' is out of bounds for '{}'...",
+                     pos.to_string(), m_Bounds.to_string());
+                throw std::exception();
+            }
+        }
+    };
+
+    //############################################################################//
+    // | TILE ORDER GENERATOR |
+    //############################################################################//
+
+    // Perfect maze built one tile at a time in row major tile order, so only the current tile &
+    // the row of tiles above it need to be resident. Each tile is carved on its own with a
+    // randomised depth first search, then joined to the tile to its west or north (chosen at
+    // random where both exist) through one opening. Every tile but the first has exactly one
+    // such join to an earlier tile, so the joins form a tree over tiles & the whole is perfect.
+    // Seeded; the same seed & tile size always give the same maze.
+    class TileOrderGenerator {
+
+    private:
+        uint64_t           m_Seed;
+        uint64_t           m_Counter;
+        Index2D            m_NextTile;
+        std::vector<bool>  m_Visited;
+        std::vector<Index> m_Stack;
+
+    public:
+        explicit TileOrderGenerator(uint64_t seed = 0);
+
+    public:
+        void reset();
+
+        bool is_complete(const TiledMaze2D& maze) const {
+            return m_NextTile.row >= maze.get_tile_grid().row;
+        }
+
+        // Carves & joins the next 'tiles' tiles
+        void step(TiledMaze2D& maze, size_t tiles = 1);
+
+        void generate(TiledMaze2D& maze) {
+            while (!is_complete(maze)) step(maze, SIZE_MAX);
+        }
+
+    private:
+        uint64_t next_random() {
+            return splitmix64(m_Seed + m_Counter++);
+        }
+
+        void carve_tile(TiledMaze2D& maze, Index2D tile);
+        void join_tile(TiledMaze2D& maze, Index2D tile);
+    };
+
+} // maze
+
+#endif
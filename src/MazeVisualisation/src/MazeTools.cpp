@@ -0,0 +1,1331 @@
+//
+// Header File: MazeTools.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+// Headless command line tools (benchmarks & batch jobs); no window or OpenGL context is created.
+//
+
+#include "MazeBiasStudy.h"
+#include "MazeCellGraph.h"
+#include "MazeComponents.h"
+#include "MazeConstructs.h"
+#include "MazeDistanceField.h"
+#include "MazeDynamicField.h"
+#include "MazeFile.h"
+#include "MazeFrozen.h"
+#include "MazeHierarchy.h"
+#include "MazeJunctionGraph.h"
+#include "MazeSolverCache.h"
+#include "MazeSolverRace.h"
+#include "MazeSolvers.h"
+#include "MazeStatistics.h"
+#include "MazeTiled.h"
+#include "MazeTreeIndex.h"
+#include "MazeView.h"
+#include "MazeWallExtractor.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <queue>
+#include <string_view>
+
+namespace maze::tools {
+
+    using Clock = std::chrono::steady_clock;
+
+    //############################################################################//
+    // | UTILITY |
+    //############################################################################//
+
+    static int print_usage();
+
+    static double elapsed_ms(const Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    static Index parse_index(int argc, char** argv, int arg, Index fallback) {
+        if (arg >= argc) return fallback;
+        return static_cast<Index>(std::stol(argv[arg]));
+    }
+
+    static Maze2D generate_maze(size_t generator, Index size) {
+        Maze2D        maze{ size, size };
+        MazeGenerator gen = get_maze_generator(generator);
+        gen->init_once(maze);
+        while (!gen->is_complete()) gen->step(maze, 1 << 16);
+        return maze;
+    }
+
+    // Opens a random wall on the given proportion of dead ends, introducing loops
+    static void braid_maze(Maze2D& maze, double ratio, std::mt19937_64& rng) {
+        std::uniform_real_distribution<double> chance{ 0.0, 1.0 };
+        std::array<Cardinal, s_CardinalCount>  dirs = s_AllCardinals;
+
+        maze.for_each_cell([&](const Index2D pos, const Cell cell) {
+            const int openings = std::popcount((cell >> 1) & 0xFU);
+            if (openings != 1 || chance(rng) >= ratio) return;
+
+            std::shuffle(dirs.begin(), dirs.end(), rng);
+            for (const Cardinal dir : dirs) {
+                if (is_wall(dir, cell) && maze.inbounds(pos, dir)) {
+                    maze.make_path(pos, dir);
+                    return;
+                }
+            }
+        });
+    }
+
+    //############################################################################//
+    // | SOLVER BENCHMARK |
+    //############################################################################//
+
+    static void bench_solver(
+            const std::string& kind,
+            Index size,
+            const Maze2D& maze,
+            MazeSolver solver
+    ) {
+        const auto start = Clock::now();
+        solver->solve(maze);
+        const double ms = elapsed_ms(start);
+
+        std::cout << std::format(
+                "{:<8} {:>6} {:<24} {:>10.2f} ms"
+                "  expanded: {:>10}  path: {:>9}  state: {:>7.2f} MiB\n",
+                kind, size, solver->get_display_name(), ms,
+                solver->get_expanded_count(), solver->get_path().size(),
+                solver->get_state_bytes() / (1024.0 * 1024.0)
+        );
+    }
+
+    // usage: bench-solvers [min_size=256] [max_size=8192] [braid_ratio=0.5]
+    static int bench_solvers(int argc, char** argv) {
+        const Index  min_size = parse_index(argc, argv, 2, 256);
+        const Index  max_size = parse_index(argc, argv, 3, 8192);
+        const double ratio    = argc > 4 ? std::stod(argv[4]) : 0.5;
+
+        std::mt19937_64 rng{ 0x5EED };
+
+        for (Index size = min_size; size <= max_size; size *= 2) {
+            Maze2D maze = generate_maze(0, size);
+
+            for (int pass = 0; pass < 2; ++pass) {
+                const std::string kind = pass == 0 ? "perfect" : "braided";
+                if (pass == 1) braid_maze(maze, ratio, rng);
+
+                bench_solver(kind, size, maze, std::make_unique<BreadthFirstSolver>());
+                bench_solver(kind, size, maze, std::make_unique<AStarSolver<ManhattanHeuristic>>());
+                bench_solver(kind, size, maze, std::make_unique<BidirectionalSolver>());
+                bench_solver(kind, size, maze, std::make_unique<ThreadedBidirectionalSolver>());
+                bench_solver(kind, size, maze, std::make_unique<DeadEndFillingSolver>());
+                bench_solver(kind, size, maze, std::make_unique<DijkstraSolver>());
+            }
+        }
+
+        return 0;
+    }
+
+    //############################################################################//
+    // | SOLVER RACE |
+    //############################################################################//
+
+    // usage: bench-race [size=2048] [braid_ratio=0.5]
+    static int bench_race(int argc, char** argv) {
+        const Index  size  = parse_index(argc, argv, 2, 2048);
+        const double ratio = argc > 3 ? std::stod(argv[3]) : 0.5;
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        const Index2D goal{ size - 1, size - 1 };
+        SolverRace    race{};
+        const auto    start = Clock::now();
+        race.start(maze, Index2D{ 0, 0 }, goal);
+        race.wait();
+        const double race_ms = elapsed_ms(start);
+
+        // The same solvers one after another for comparison; contention shows in the difference
+        double sequential_ms = 0.0;
+        for (const auto& factory : s_MazeSolverFactories) {
+            MazeSolver solver = factory();
+            solver->set_endpoints(Index2D{ 0, 0 }, goal);
+            const auto solo = Clock::now();
+            solver->solve(maze);
+            sequential_ms += elapsed_ms(solo);
+        }
+
+        const size_t winner = race.get_winner();
+        for (size_t i = 0; i < race.get_results().size(); ++i) {
+            const SolverRace::Result& result = race.get_results()[i];
+            std::cout << std::format(
+                    "{} {:<30} {:>10.2f} ms  solved: {:<5}  expanded: {:>10}  path: {:>9}"
+                    "  state: {:>7.2f} MiB\n",
+                    i == winner ? '*' : ' ', result.name, result.solve_ms, result.is_solved,
+                    result.expanded, result.path_length, result.state_bytes / (1024.0 * 1024.0)
+            );
+        }
+
+        std::cout << std::format(
+                "{} x {}  race: {:.2f} ms  sequential: {:.2f} ms  snapshot: {:.2f} MiB\n",
+                size, size, race_ms, sequential_ms,
+                maze.get_size() * sizeof(Cell) / (1024.0 * 1024.0)
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | SOLVER CACHE |
+    //############################################################################//
+
+    // usage: bench-cache [size=2048] [queries=4096] [distinct=64]
+    static int bench_cache(int argc, char** argv) {
+        const Index size     = parse_index(argc, argv, 2, 2048);
+        const Index queries  = parse_index(argc, argv, 3, 4096);
+        const Index distinct = parse_index(argc, argv, 4, 64);
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        Distribution    dist{ 0, size - 1 };
+
+        std::vector<std::pair<Index2D, Index2D>> pairs{};
+        for (Index i = 0; i < distinct; ++i) {
+            pairs.emplace_back(Index2D{ dist(rng), dist(rng) }, Index2D{ dist(rng), dist(rng) });
+        }
+
+        // Repeated queries drawn from a small set of endpoints; solver 2 is A*
+        constexpr size_t solver = 2;
+        const auto       run    = [&](SolverCache& cache) {
+            Distribution pick{ 0, distinct - 1 };
+            size_t       length = 0;
+            const auto   start  = Clock::now();
+            for (Index i = 0; i < queries; ++i) {
+                const auto& [a, b] = pairs[pick(rng)];
+                length += cache.find_path(maze, a, b, solver).size();
+            }
+            return std::make_pair(elapsed_ms(start), length);
+        };
+
+        SolverCache cache{};
+        const auto [cached_ms, cached_length] = run(cache);
+
+        const Index sample = std::min<Index>(queries, distinct * 2);
+        const auto  start  = Clock::now();
+        for (Index i = 0; i < sample; ++i) {
+            MazeSolver search = get_maze_solver(solver);
+            search->set_endpoints(pairs[i % distinct].first, pairs[i % distinct].second);
+            search->solve(maze);
+        }
+        const double solve_ms = elapsed_ms(start) / sample;
+
+        std::cout << std::format(
+                "{} x {}  {} queries ({} distinct)  cached: {:.2f} ms ({} hits, {} misses,"
+                " {:.2f} KiB)  uncached: ~{:.2f} ms  path cells: {}\n",
+                size, size, queries, distinct, cached_ms, cache.get_hit_count(),
+                cache.get_miss_count(), cache.get_cached_bytes() / 1024.0, solve_ms * queries,
+                cached_length
+        );
+
+        // Opening a wall changes the hash; the same queries miss until re-solved
+        const uint64_t before = maze.get_hash();
+        const auto     change = Clock::now();
+        for (Index i = 0; i < 1024; ++i) {
+            const Index2D  pos{ dist(rng), dist(rng) };
+            const Cardinal dir = static_cast<Cardinal>(dist(rng) % s_CardinalCount);
+            if (maze.inbounds(pos, dir)) maze.make_path(pos, dir);
+        }
+        const double change_ms = elapsed_ms(change);
+
+        const uint64_t incremental = maze.get_hash();
+        maze.rehash();
+
+        const size_t misses = cache.get_miss_count();
+        run(cache);
+        std::cout << std::format(
+                "1024 changes in {:.3f} ms  hash: {:016x} -> {:016x}  rehash matches: {}"
+                "  misses after change: {}\n",
+                change_ms, before, incremental, incremental == maze.get_hash(),
+                cache.get_miss_count() - misses
+        );
+
+        // Distance fields are handed out shared
+        SolverCache::FieldPtr field = cache.get_distance_field(maze, Index2D{ 0, 0 });
+        const auto            again = Clock::now();
+        SolverCache::FieldPtr hit   = cache.get_distance_field(maze, Index2D{ 0, 0 });
+        std::cout << std::format(
+                "distance field hit: {:.4f} ms  shared: {}\n", elapsed_ms(again), field == hit
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | DISTANCE FIELD BENCHMARK |
+    //############################################################################//
+
+    // Plain FIFO BFS used as the reference for the level synchronous implementation
+    static void queue_distance_field(const Maze2D& maze, Index source, DistanceField& distances) {
+        distances.assign(maze.get_size(), s_Unreachable);
+        IndexRingBuffer queue{};
+
+        distances[source] = 0;
+        queue.push(source);
+        while (!queue.empty()) {
+            const Index pos = queue.front();
+            queue.pop();
+            for_each_open(maze, pos, [&](Cardinal, const Index next) {
+                if (distances[next] != s_Unreachable) return;
+                distances[next] = distances[pos] + 1;
+                queue.push(next);
+            });
+        }
+    }
+
+    // usage: bench-distance [min_size=1024] [max_size=16384] [braid_ratio=0.5]
+    static int bench_distance(int argc, char** argv) {
+        const Index  min_size = parse_index(argc, argv, 2, 1024);
+        const Index  max_size = parse_index(argc, argv, 3, 16384);
+        const double ratio    = argc > 4 ? std::stod(argv[4]) : 0.5;
+
+        std::mt19937_64        rng{ 0x5EED };
+        DirectionOptimisingBfs bfs{};
+        DistanceField          expected{};
+        DistanceField          actual{};
+
+        std::cout << std::format("threads: {}\n", ThreadPool::get_shared().get_thread_count());
+
+        for (Index size = min_size; size <= max_size; size *= 2) {
+            Maze2D maze = generate_maze(0, size);
+
+            for (int pass = 0; pass < 2; ++pass) {
+                const std::string kind = pass == 0 ? "perfect" : "braided";
+                if (pass == 1) braid_maze(maze, ratio, rng);
+
+                auto start = Clock::now();
+                queue_distance_field(maze, 0, expected);
+                const double queue_ms = elapsed_ms(start);
+
+                start = Clock::now();
+                bfs.compute(maze, Index2D{ 0, 0 }, actual);
+                const double level_ms = elapsed_ms(start);
+
+                std::cout << std::format(
+                        "{:<8} {:>6}  queue: {:>10.2f} ms  direction optimising: {:>10.2f} ms"
+                        "  levels: {:>9} (bottom-up: {:>5})  {}\n",
+                        kind, size, queue_ms, level_ms,
+                        bfs.get_level_count(), bfs.get_bottom_up_level_count(),
+                        expected == actual ? "match" : "MISMATCH"
+                );
+            }
+        }
+
+        return 0;
+    }
+
+    //############################################################################//
+    // | JUNCTION GRAPH BENCHMARK |
+    //############################################################################//
+
+    // usage: bench-junction [size=2048] [queries=256] [braid_ratio=0.1]
+    static int bench_junction(int argc, char** argv) {
+        const Index  size    = parse_index(argc, argv, 2, 2048);
+        const Index  queries = parse_index(argc, argv, 3, 256);
+        const double ratio   = argc > 4 ? std::stod(argv[4]) : 0.1;
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        JunctionGraph graph{};
+        auto          start = Clock::now();
+        graph.build(maze);
+        std::cout << std::format(
+                "{} x {}  build: {:.2f} ms  nodes: {} ({:.1f}% of cells)  edges: {}\n",
+                size, size, elapsed_ms(start), graph.get_node_count(),
+                100.0 * graph.get_node_count() / maze.get_size(), graph.get_edge_count()
+        );
+
+        Distribution dist{ 0, size - 1 };
+        double       cell_ms        = 0.0;
+        double       graph_ms       = 0.0;
+        size_t       cell_expanded  = 0;
+        size_t       graph_expanded = 0;
+        size_t       mismatches     = 0;
+
+        for (Index i = 0; i < queries; ++i) {
+            const Index2D from{ dist(rng), dist(rng) };
+            const Index2D to{ dist(rng), dist(rng) };
+
+            AStarSolver<ManhattanHeuristic> solver{};
+            solver.set_endpoints(from, to);
+            start = Clock::now();
+            solver.solve(maze);
+            cell_ms += elapsed_ms(start);
+            cell_expanded += solver.get_expanded_count();
+
+            start = Clock::now();
+            const JunctionGraph::Route route = graph.find_route(maze, from, to);
+            const std::vector<Index>   path  = graph.expand_route(maze, from, route);
+            graph_ms += elapsed_ms(start);
+            graph_expanded += graph.get_expanded_count();
+
+            if (path.size() != solver.get_path().size()) ++mismatches;
+        }
+
+        std::cout << std::format(
+                "{} queries\n  cell a*:     {:>10.2f} ms  expanded: {:>12}\n"
+                "  junction a*: {:>10.2f} ms  expanded: {:>12}  mismatches: {}\n",
+                queries, cell_ms, cell_expanded, graph_ms, graph_expanded, mismatches
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | LCA INDEX BENCHMARK |
+    //############################################################################//
+
+    // usage: bench-lca [size=2048] [queries=1000000]
+    static int bench_lca(int argc, char** argv) {
+        const Index size    = parse_index(argc, argv, 2, 2048);
+        const Index queries = parse_index(argc, argv, 3, 1000000);
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+
+        LcaIndex index{};
+        auto     start = Clock::now();
+        index.build(maze);
+        std::cout << std::format(
+                "{} x {}  build: {:.2f} ms  state: {:.2f} MiB\n",
+                size, size, elapsed_ms(start), index.get_state_bytes() / (1024.0 * 1024.0)
+        );
+
+        Distribution       dist{ 0, static_cast<Index>(maze.get_size()) - 1 };
+        std::vector<Index> pairs(static_cast<size_t>(queries) * 2);
+        for (Index& cell : pairs) cell = dist(rng);
+
+        uint64_t checksum = 0;
+        start = Clock::now();
+        for (size_t i = 0; i < pairs.size(); i += 2) {
+            checksum += index.distance(pairs[i], pairs[i + 1]);
+        }
+        const double distance_ms = elapsed_ms(start);
+
+        start = Clock::now();
+        for (size_t i = 0; i < pairs.size(); i += 2) {
+            const auto step = index.next_step(pairs[i], pairs[i + 1]);
+            checksum += static_cast<uint64_t>(step.value_or(Cardinal::NORTH));
+        }
+        const double step_ms = elapsed_ms(start);
+
+        // Spot check against a full search
+        size_t mismatches = 0;
+        for (size_t i = 0; i < 8 && i * 2 < pairs.size(); ++i) {
+            BreadthFirstSolver solver{};
+            const Index        cols = maze.get_col_count();
+            solver.set_endpoints(
+                    Index2D{ pairs[i * 2] / cols, pairs[i * 2] % cols },
+                    Index2D{ pairs[i * 2 + 1] / cols, pairs[i * 2 + 1] % cols }
+            );
+            solver.solve(maze);
+            if (solver.get_path() != index.path(pairs[i * 2], pairs[i * 2 + 1])) ++mismatches;
+        }
+
+        std::cout << std::format(
+                "{} queries  distance: {:.1f} ns/query  next step: {:.1f} ns/query"
+                "  bfs mismatches: {}  ({})\n",
+                queries, distance_ms * 1e6 / queries, step_ms * 1e6 / queries,
+                mismatches, checksum
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | HIERARCHICAL PATHFINDING BENCHMARK |
+    //############################################################################//
+
+    // usage: bench-hpa [size=4096] [queries=64] [braid_ratio=0.1] [cluster_size=32]
+    static int bench_hpa(int argc, char** argv) {
+        const Index  size    = parse_index(argc, argv, 2, 4096);
+        const Index  queries = parse_index(argc, argv, 3, 64);
+        const double ratio   = argc > 4 ? std::stod(argv[4]) : 0.1;
+        const Index  cluster = parse_index(
+                argc, argv, 5, HierarchicalPathfinder::s_DefaultClusterSize
+        );
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        HierarchicalPathfinder hpa{ cluster };
+        auto                   start = Clock::now();
+        hpa.build(maze);
+        std::cout << std::format(
+                "{} x {}  build: {:.2f} ms  clusters: {}  entrances: {}  state: {:.2f} MiB\n",
+                size, size, elapsed_ms(start), hpa.get_cluster_count(), hpa.get_node_count(),
+                hpa.get_state_bytes() / (1024.0 * 1024.0)
+        );
+
+        Distribution dist{ 0, size - 1 };
+        double       cell_ms       = 0.0;
+        double       hpa_ms        = 0.0;
+        size_t       cell_expanded = 0;
+        size_t       hpa_expanded  = 0;
+        size_t       hpa_refined   = 0;
+        size_t       mismatches    = 0;
+
+        for (Index i = 0; i < queries; ++i) {
+            const Index2D from{ dist(rng), dist(rng) };
+            const Index2D to{ dist(rng), dist(rng) };
+
+            AStarSolver<ManhattanHeuristic> solver{};
+            solver.set_endpoints(from, to);
+            start = Clock::now();
+            solver.solve(maze);
+            cell_ms += elapsed_ms(start);
+            cell_expanded += solver.get_expanded_count();
+
+            start = Clock::now();
+            const std::vector<Index> path = hpa.find_path(maze, from, to);
+            hpa_ms += elapsed_ms(start);
+            hpa_expanded += hpa.get_expanded_count();
+            hpa_refined += hpa.get_refined_count();
+
+            if (path.size() != solver.get_path().size()) ++mismatches;
+        }
+
+        std::cout << std::format(
+                "{} queries\n  cell a*: {:>10.2f} ms  expanded: {:>12}\n"
+                "  hpa*:    {:>10.2f} ms  expanded: {:>12}  refined clusters: {}  mismatches: {}\n",
+                queries, cell_ms, cell_expanded, hpa_ms, hpa_expanded, hpa_refined, mismatches
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | DYNAMIC DISTANCE FIELD BENCHMARK |
+    //############################################################################//
+
+    // usage: bench-dynamic [size=2048] [changes=4096]
+    static int bench_dynamic(int argc, char** argv) {
+        const Index size    = parse_index(argc, argv, 2, 2048);
+        const Index changes = parse_index(argc, argv, 3, 4096);
+
+        std::mt19937_64 rng{ 0x5EED };
+
+        // Live generation; every carved wall is repaired into the field as it happens
+        Maze2D               maze{ size, size };
+        DynamicDistanceField field{ maze, Index2D{ 0, 0 } };
+        MazeGenerator        gen   = get_maze_generator(0);
+        auto                 start = Clock::now();
+        gen->init_once(maze);
+        while (!gen->is_complete()) gen->step(maze, 1 << 16);
+        const double generate_ms = elapsed_ms(start);
+
+        DistanceField expected{};
+        queue_distance_field(maze, 0, expected);
+        std::cout << std::format(
+                "{} x {}  generate + repair: {:.2f} ms  repairs: {}  rebuilds: {}  {}\n",
+                size, size, generate_ms, field.get_repair_count(), field.get_rebuild_count(),
+                expected == field.get_distances() ? "match" : "MISMATCH"
+        );
+
+        // Random openings on the finished maze against a full recompute per change
+        Distribution dist{ 0, size - 1 };
+        double       repair_ms = 0.0;
+        size_t       touched   = 0;
+        for (Index i = 0; i < changes; ++i) {
+            const Index2D  pos{ dist(rng), dist(rng) };
+            const Cardinal dir = static_cast<Cardinal>(dist(rng) % s_CardinalCount);
+            if (!maze.inbounds(pos, dir)) continue;
+
+            start = Clock::now();
+            maze.make_path(pos, dir);
+            repair_ms += elapsed_ms(start);
+            touched += field.get_changed_cells().size();
+        }
+
+        DirectionOptimisingBfs bfs{};
+        DistanceField          actual{};
+        start = Clock::now();
+        bfs.compute(maze, Index2D{ 0, 0 }, actual);
+        const double rebuild_ms = elapsed_ms(start);
+
+        std::cout << std::format(
+                "{} changes  repair: {:.4f} ms/change ({:.0f} cells/change)"
+                "  full recompute: {:.2f} ms  {}\n",
+                changes, repair_ms / changes, static_cast<double>(touched) / changes, rebuild_ms,
+                actual == field.get_distances() ? "match" : "MISMATCH"
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | WEIGHTED DIJKSTRA BENCHMARK |
+    //############################################################################//
+
+    // Comparison heap reference; same lazy deletion scheme as the bucket queue solver
+    static uint32_t priority_queue_dijkstra(const Maze2D& maze, Index start, Index goal) {
+        using Entry = std::pair<uint32_t, Index>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> open{};
+        std::vector<uint32_t> costs(maze.get_size(), UINT32_MAX);
+        const uint8_t*        weights = maze.get_cost_data();
+
+        costs[start] = 0;
+        open.emplace(0, start);
+        while (!open.empty()) {
+            const auto [cost, pos] = open.top();
+            open.pop();
+            if (cost != costs[pos]) continue;
+            if (pos == goal) return cost;
+
+            for_each_open(maze, pos, [&](Cardinal, const Index next) {
+                const uint32_t next_cost = cost + weights[next];
+                if (next_cost >= costs[next]) return;
+                costs[next] = next_cost;
+                open.emplace(next_cost, next);
+            });
+        }
+        return UINT32_MAX;
+    }
+
+    // usage: bench-weighted [size=4096] [max_cost=9] [braid_ratio=0.5]
+    static int bench_weighted(int argc, char** argv) {
+        const Index  size     = parse_index(argc, argv, 2, 4096);
+        const Index  max_cost = std::clamp<Index>(parse_index(argc, argv, 3, 9), 1, 255);
+        const double ratio    = argc > 4 ? std::stod(argv[4]) : 0.5;
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        Distribution cost{ 1, max_cost };
+        maze.enable_costs();
+        maze.for_each_cell([&](const Index2D pos, Cell) {
+            maze.set_cost(pos, static_cast<uint8_t>(cost(rng)));
+        });
+
+        const Index2D goal{ size - 1, size - 1 };
+        auto          start    = Clock::now();
+        const uint32_t expected = priority_queue_dijkstra(maze, 0, goal.flat(size));
+        const double   queue_ms = elapsed_ms(start);
+
+        DijkstraSolver solver{};
+        solver.set_endpoints(Index2D{ 0, 0 }, goal);
+        start = Clock::now();
+        solver.solve(maze);
+        const double bucket_ms = elapsed_ms(start);
+
+        std::cout << std::format(
+                "{} x {}  costs: 1-{}\n  priority queue: {:>10.2f} ms  cost: {}\n"
+                "  bucket queue:   {:>10.2f} ms  cost: {}  expanded: {}  state: {:.2f} MiB  {}\n",
+                size, size, max_cost, queue_ms, expected, bucket_ms, solver.get_path_cost(),
+                solver.get_expanded_count(), solver.get_state_bytes() / (1024.0 * 1024.0),
+                expected == solver.get_path_cost() ? "match" : "MISMATCH"
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | FLOW FIELD BENCHMARK |
+    //############################################################################//
+
+    // usage: bench-flow [size=2048] [agents=100000] [changes=1024]
+    static int bench_flow(int argc, char** argv) {
+        const Index size    = parse_index(argc, argv, 2, 2048);
+        const Index agents  = parse_index(argc, argv, 3, 100000);
+        const Index changes = parse_index(argc, argv, 4, 1024);
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        const Index2D   goal{ size / 2, size / 2 };
+
+        auto      start = Clock::now();
+        FlowField field{ maze, goal };
+        std::cout << std::format(
+                "{} x {}  build: {:.2f} ms  state: {:.2f} MiB\n",
+                size, size, elapsed_ms(start), field.get_state_bytes() / (1024.0 * 1024.0)
+        );
+
+        // Per agent searches for comparison; a few A* solves scaled to the agent count
+        Distribution       dist{ 0, size - 1 };
+        std::vector<Index> positions(static_cast<size_t>(agents));
+        for (Index& pos : positions) pos = Index2D{ dist(rng), dist(rng) }.flat(size);
+
+        constexpr size_t samples = 8;
+        start = Clock::now();
+        for (size_t i = 0; i < samples; ++i) {
+            AStarSolver<ManhattanHeuristic> solver{};
+            solver.set_endpoints(Index2D{ positions[i] / size, positions[i] % size }, goal);
+            solver.solve(maze);
+        }
+        const double search_ms = elapsed_ms(start) / samples;
+
+        // Paths in a perfect maze are long; a fixed number of frames rather than until arrival
+        constexpr size_t steps   = 256;
+        size_t           arrived = 0;
+        start = Clock::now();
+        for (size_t i = 0; i < steps; ++i) arrived = field.advance(positions);
+        const double flow_ms = elapsed_ms(start);
+
+        std::cout << std::format(
+                "{} agents  a* per agent: {:.2f} ms (~{:.0f} ms for all)"
+                "  flow: {} steps in {:.2f} ms ({:.2f} ns/agent step, {} arrived)\n",
+                agents, search_ms, search_ms * agents, steps, flow_ms,
+                flow_ms * 1e6 / (static_cast<double>(steps) * agents), arrived
+        );
+
+        // Random openings; only the cells whose distance dropped are re-pointed
+        double repair_ms = 0.0;
+        for (Index i = 0; i < changes; ++i) {
+            const Index2D  pos{ dist(rng), dist(rng) };
+            const Cardinal dir = static_cast<Cardinal>(dist(rng) % s_CardinalCount);
+            if (!maze.inbounds(pos, dir)) continue;
+
+            start = Clock::now();
+            maze.make_path(pos, dir);
+            repair_ms += elapsed_ms(start);
+        }
+
+        FlowField fresh{ maze, goal };
+        size_t    mismatches = 0;
+        for (Index i = 0; i < static_cast<Index>(maze.get_size()); ++i) {
+            const uint32_t next = field.get_distances()[field.next_cell(i)];
+            if (field.get_distances()[i] != fresh.get_distances()[i]) ++mismatches;
+            else if (i != field.get_goal() && next + 1 != field.get_distances()[i]) ++mismatches;
+        }
+
+        std::cout << std::format(
+                "{} changes  repair: {:.4f} ms/change  mismatches: {}\n",
+                changes, repair_ms / changes, mismatches
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | MAZE VALIDATION |
+    //############################################################################//
+
+    static MazeValidation print_validation(const std::string& name, const Maze2D& maze) {
+        const auto           start  = Clock::now();
+        const MazeValidation report = validate_maze(maze);
+        const double         ms     = elapsed_ms(start);
+
+        std::cout << std::format(
+                "{:<30} {:>10.2f} ms ({:.2f} ns/cell)  {}\n",
+                name, ms, ms * 1e6 / static_cast<double>(maze.get_size()), report.to_string()
+        );
+        return report;
+    }
+
+    // usage: bench-validate [size=4096]
+    static int bench_validate(int argc, char** argv) {
+        const Index size = parse_index(argc, argv, 2, 4096);
+
+        for (size_t i = 0; i < s_MazeGeneratorFactories.size(); ++i) {
+            print_validation(get_maze_generator(i)->get_display_name(), generate_maze(i, size));
+        }
+
+        // Not registered as a generator; walls are random so the result is rarely connected
+        Maze2D        random{ size, size };
+        MazeGenerator gen = make_generator<RandomMazeImpl>();
+        gen->init_once(random);
+        while (!gen->is_complete()) gen->step(random, 1 << 16);
+        print_validation(gen->get_display_name(), random);
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          braided = generate_maze(0, size);
+        braid_maze(braided, 0.5, rng);
+        print_validation("Braided (0.5)", braided);
+        return 0;
+    }
+
+    // usage: validate-file <path>; exits with 2 if the maze is not perfect
+    static int validate_file(int argc, char** argv) {
+        if (argc < 3) return print_usage();
+        const Maze2D maze = read_maze_file(argv[2]);
+        return print_validation(argv[2], maze).is_perfect() ? 0 : 2;
+    }
+
+    //############################################################################//
+    // | MAZE STATISTICS |
+    //############################################################################//
+
+    // usage: bench-stats [size=2048] [generator=0] [braid_ratio=0.0]
+    static int bench_stats(int argc, char** argv) {
+        const Index  size      = parse_index(argc, argv, 2, 2048);
+        const Index  generator = parse_index(argc, argv, 3, 0);
+        const double ratio     = argc > 4 ? std::stod(argv[4]) : 0.0;
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(static_cast<size_t>(generator), size);
+        braid_maze(maze, ratio, rng);
+
+        MazeAnalyser         analyser{};
+        const auto           start = Clock::now();
+        const MazeStatistics stats = analyser.analyse(maze);
+        const double         ms    = elapsed_ms(start);
+
+        std::cout << stats.to_json() << '\n';
+        std::cerr << std::format("{} x {}  analysed in {:.2f} ms\n", size, size, ms);
+        return 0;
+    }
+
+    // usage: stats-file <path>; one JSON line on stdout
+    static int stats_file(int argc, char** argv) {
+        if (argc < 3) return print_usage();
+        const Maze2D maze = read_maze_file(argv[2]);
+        MazeAnalyser analyser{};
+        std::cout << analyser.analyse(maze).to_json() << '\n';
+        return 0;
+    }
+
+    // usage: bias-study [size=32] [mazes=10000] [generator=-1 (all)] [seed=0]; one JSON line per
+    // generator on stdout
+    static int bias_study(int argc, char** argv) {
+        const Index    size      = parse_index(argc, argv, 2, 32);
+        const Index    mazes     = parse_index(argc, argv, 3, 10000);
+        const Index    generator = parse_index(argc, argv, 4, -1);
+        const uint64_t seed      = argc > 5 ? std::stoull(argv[5]) : 0;
+
+        for (size_t i = 0; i < s_MazeGeneratorFactories.size(); ++i) {
+            if (generator >= 0 && static_cast<size_t>(generator) != i) continue;
+
+            const GeneratorBias bias = run_bias_study(
+                    i, Index2D{ size, size }, static_cast<size_t>(mazes), seed
+            );
+            std::cout << bias.to_json() << std::endl;
+            std::cerr << std::format(
+                    "{:<28} {:>8} mazes {:>8.2f} s {:>12.0f} / hour  dead ends {:.4f}  "
+                    "corridor {:.3f}  solution {:.1f}\n",
+                    bias.generator, bias.maze_count, bias.seconds, bias.get_mazes_per_hour(),
+                    bias.dead_end_ratio.get_mean(), bias.mean_corridor_length.get_mean(),
+                    bias.solution_length.get_mean()
+            );
+        }
+        return 0;
+    }
+
+    //############################################################################//
+    // | CELL GRAPH |
+    //############################################################################//
+
+    // usage: bench-graph [size=4096] [braid_ratio=0.25] [walk_steps=10000000]
+    static int bench_graph(int argc, char** argv) {
+        const Index  size  = parse_index(argc, argv, 2, 4096);
+        const double ratio = argc > 3 ? std::stod(argv[3]) : 0.25;
+        const Index  steps = parse_index(argc, argv, 4, 10'000'000);
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        CellGraph  graph{};
+        const auto build_start = Clock::now();
+        graph.build(maze);
+        const double build_ms = elapsed_ms(build_start);
+
+        // Random walks; once through the per cell flag checks a kernel adaptor would need, once
+        // over the CSR arrays
+        const auto adaptor_start = Clock::now();
+        Index      adaptor_pos   = 0;
+        for (Index i = 0; i < steps; ++i) {
+            std::array<Index, s_CardinalCount> next{};
+            size_t                             count = 0;
+            for_each_open(maze, adaptor_pos, [&](Cardinal, const Index n) { next[count++] = n; });
+            if (count != 0) adaptor_pos = next[rng() % count];
+        }
+        const double adaptor_ms = elapsed_ms(adaptor_start);
+
+        const std::vector<uint32_t>& offsets    = graph.get_offsets();
+        const std::vector<uint32_t>& neighbours = graph.get_neighbours();
+        const auto                   csr_start  = Clock::now();
+        uint32_t                     csr_pos    = 0;
+        for (Index i = 0; i < steps; ++i) {
+            const uint32_t degree = offsets[csr_pos + 1] - offsets[csr_pos];
+            if (degree != 0) csr_pos = neighbours[offsets[csr_pos] + rng() % degree];
+        }
+        const double csr_ms = elapsed_ms(csr_start);
+
+        std::cout << std::format(
+                "{} x {}  vertices {}  edges {}  build {:.2f} ms  ({:.2f} MiB)\n"
+                "random walk of {} steps  adaptor {:.2f} ms  csr {:.2f} ms  (ends {} / {})\n",
+                size, size, graph.get_vertex_count(), graph.get_edge_count(), build_ms,
+                graph.get_state_bytes() / (1024.0 * 1024.0), steps, adaptor_ms, csr_ms,
+                adaptor_pos, csr_pos
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | MAZE VIEWS |
+    //############################################################################//
+
+    // usage: bench-tiles [size=4096] [tile=256]
+    // Every tile is carved as a binary tree (north or west, clipped to the tile) on its own
+    // thread through a view, then the tiles are stitched into one tree on the calling thread.
+    static int bench_tiles(int argc, char** argv) {
+        const Index size = parse_index(argc, argv, 2, 4096);
+        const Index tile = parse_index(argc, argv, 3, 256);
+
+        const Index  tiles_across = (size + tile - 1) / tile;
+        const size_t tile_count   = static_cast<size_t>(tiles_across) * tiles_across;
+        Maze2D       maze{ size, size };
+
+        const auto carve_start = Clock::now();
+        ThreadPool::get_shared().run(tile_count, [&](const size_t index) {
+            const Index2D   origin{ static_cast<Index>(index) / tiles_across * tile,
+                                    static_cast<Index>(index) % tiles_across * tile };
+            MazeView        view{ maze, origin, Index2D{ tile, tile } };
+            std::mt19937_64 rng{ splitmix64(index) };
+
+            view.for_each_cell([&](const Index2D pos, Cell) {
+                const bool north = view.inbounds(pos, Cardinal::NORTH);
+                const bool west  = view.inbounds(pos, Cardinal::WEST);
+                if (north && (!west || (rng() & 1))) {
+                    view.make_path(pos, Cardinal::NORTH);
+                } else if (west) {
+                    view.make_path(pos, Cardinal::WEST);
+                }
+            });
+        });
+        const double carve_ms = elapsed_ms(carve_start);
+
+        // Tiles join their west neighbour, the first column of tiles joins north
+        for (Index row = 0; row < tiles_across; ++row) {
+            for (Index col = 0; col < tiles_across; ++col) {
+                if (col > 0) maze.make_path(Index2D{ row * tile, col * tile }, Cardinal::WEST);
+                else if (row > 0) maze.make_path(Index2D{ row * tile, 0 }, Cardinal::NORTH);
+            }
+        }
+
+        // The hash kept through the views must match a full rehash
+        const uint64_t hash = maze.get_hash();
+        maze.rehash();
+
+        size_t              view_walls = 0;
+        const ConstMazeView whole{ maze };
+        whole.for_each_wall_unique([&](Cardinal, Index2D, Cell) { ++view_walls; });
+        size_t maze_walls = 0;
+        maze.for_each_wall_unique([&](Cardinal, Index2D, Cell) { ++maze_walls; });
+
+        std::cout << std::format(
+                "{} x {} in {} tiles of {}  carved in {:.2f} ms  hash {}  walls {} / {}\n",
+                size, size, tile_count, tile, carve_ms,
+                hash == maze.get_hash() ? "matches" : "DIFFERS", view_walls, maze_walls
+        );
+        return print_validation("Tiled Binary Tree", maze).is_perfect() ? 0 : 2;
+    }
+
+    //############################################################################//
+    // | WALL EXTRACTION |
+    //############################################################################//
+
+    // usage: bench-walls [size=4096] [braid_ratio=0.0]
+    static int bench_walls(int argc, char** argv) {
+        const Index  size  = parse_index(argc, argv, 2, 4096);
+        const double ratio = argc > 3 ? std::stod(argv[3]) : 0.0;
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        // Baseline; what MazeManager::init used to do minus the entities
+        std::vector<uint32_t> expected{};
+        expected.reserve(maze.get_total_wall_count());
+        const auto lambda_start = Clock::now();
+        maze.for_each_wall_unique([&](const Cardinal dir, const Index2D& pos, Cell) {
+            expected.push_back(WallExtractor::pack_wall(pos.flat(size), dir));
+        });
+        const double lambda_ms = elapsed_ms(lambda_start);
+
+        WallExtractor walls{};
+        walls.extract(maze);
+        const auto kernel_start = Clock::now();
+        walls.extract(maze);
+        const double kernel_ms = elapsed_ms(kernel_start);
+
+        // Same walls, different order within a cell
+        std::vector<uint32_t> actual = walls.get_walls();
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+
+        size_t run_walls = 0;
+        for (const WallRun& run : walls.get_horizontal_runs()) run_walls += run.length;
+        for (const WallRun& run : walls.get_vertical_runs()) run_walls += run.length;
+
+        std::cout << std::format(
+                "{} x {}  walls {}  for_each_wall_unique {:.2f} ms  kernel {:.2f} ms  ({})\n"
+                "runs {} horizontal  {} vertical  covering {} walls\n",
+                size, size, walls.get_wall_count(), lambda_ms, kernel_ms,
+                actual == expected ? "match" : "MISMATCH",
+                walls.get_horizontal_runs().size(), walls.get_vertical_runs().size(), run_walls
+        );
+        return actual == expected && run_walls == actual.size() ? 0 : 2;
+    }
+
+    //############################################################################//
+    // | FROZEN MAZES |
+    //############################################################################//
+
+    // usage: bench-freeze [size=4096] [braid_ratio=0.0] [path]
+    static int bench_freeze(int argc, char** argv) {
+        const Index  size  = parse_index(argc, argv, 2, 4096);
+        const double ratio = argc > 3 ? std::stod(argv[3]) : 0.0;
+
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        const auto       freeze_start = Clock::now();
+        const FrozenMaze frozen{ maze };
+        const double     freeze_ms    = elapsed_ms(freeze_start);
+
+        const auto   thaw_start = Clock::now();
+        const Maze2D thawed     = frozen.thaw();
+        const double thaw_ms    = elapsed_ms(thaw_start);
+
+        // Every side through the constant time lookup against the original cells
+        size_t mismatches = 0;
+        maze.for_each_cell([&](const Index2D pos, const Cell cell) {
+            if (frozen.get_openings(pos) != openings_of(cell)) ++mismatches;
+            for (const Cardinal dir : s_AllCardinals) {
+                if (frozen.is_wall(pos, dir) == is_set(path_flag_for_dir(dir), cell)) ++mismatches;
+            }
+        });
+
+        const size_t cell_bytes = maze.get_size() * sizeof(Cell);
+        std::cout << std::format(
+                "{} x {}  freeze {:.2f} ms  thaw {:.2f} ms  {:.2f} MiB -> {:.2f} MiB"
+                "  hash {}  mismatches {}\n",
+                size, size, freeze_ms, thaw_ms, cell_bytes / (1024.0 * 1024.0),
+                frozen.get_state_bytes() / (1024.0 * 1024.0),
+                thawed.get_hash() == maze.get_hash() ? "matches" : "DIFFERS", mismatches
+        );
+
+        if (argc > 4) {
+            const auto write_start = Clock::now();
+            write_frozen_maze(frozen, argv[4]);
+            const double     write_ms   = elapsed_ms(write_start);
+            const auto       read_start = Clock::now();
+            const FrozenMaze loaded     = read_frozen_maze(argv[4]);
+            std::cout << std::format(
+                    "wrote '{}' in {:.2f} ms  read in {:.2f} ms  ({})\n", argv[4], write_ms,
+                    elapsed_ms(read_start),
+                    loaded.get_words() == frozen.get_words() ? "match" : "MISMATCH"
+            );
+        }
+        return mismatches == 0 && thawed.get_hash() == maze.get_hash() ? 0 : 2;
+    }
+
+    //############################################################################//
+    // | OUT OF CORE MAZES |
+    //############################################################################//
+
+    // usage: build-tiled <path> [size=16384] [tile=256] [budget_mib=64] [seed=1]; the file is a
+    // CELLS maze file so the other file commands read it
+    static int build_tiled(int argc, char** argv) {
+        if (argc < 3) return print_usage();
+        const std::string path   = argv[2];
+        const Index       size   = parse_index(argc, argv, 3, 16384);
+        const Index       tile   = parse_index(argc, argv, 4, TiledMaze2D::s_DefaultTileSize);
+        const Index       budget = parse_index(argc, argv, 5, 64);
+        const uint64_t    seed   = argc > 6 ? std::stoull(argv[6]) : 1;
+
+        const auto  start = Clock::now();
+        TiledMaze2D maze{
+                path,
+                Index2D{ size, size },
+                tile,
+                static_cast<size_t>(budget) * 1024 * 1024,
+                MazeFileInfo{ s_UnknownGenerator, seed }
+        };
+
+        TileOrderGenerator generator{ seed };
+        size_t             peak_bytes = 0;
+        while (!generator.is_complete(maze)) {
+            generator.step(maze, static_cast<size_t>(maze.get_tile_grid().col));
+            peak_bytes = std::max(peak_bytes, maze.get_state_bytes());
+        }
+        maze.flush();
+
+        std::cout << std::format(
+                "{} x {} in {} x {} tiles of {}  built in {:.2f} s  peak resident {:.2f} MiB"
+                "  tile reads {}  tile writes {}\n",
+                size, size, maze.get_tile_grid().row, maze.get_tile_grid().col, tile,
+                elapsed_ms(start) / 1000.0, peak_bytes / (1024.0 * 1024.0),
+                maze.get_tile_reads(), maze.get_tile_writes()
+        );
+        return 0;
+    }
+
+    //############################################################################//
+    // | MAZE FILES |
+    //############################################################################//
+
+    static const char* layout_name(const MazeLayout layout) {
+        switch (layout) {
+            case MazeLayout::NIBBLES:
+                return "nibbles";
+            case MazeLayout::CELLS:
+                return "cells";
+            case MazeLayout::FROZEN:
+                return "frozen";
+        }
+        return "?";
+    }
+
+    // usage: export-maze <path> [size=4096] [braid_ratio=0.0] [layout=cells|nibbles|frozen]
+    //        [seed=0]
+    static int export_maze(int argc, char** argv) {
+        if (argc < 3) return print_usage();
+        const std::string      path  = argv[2];
+        const Index            size  = parse_index(argc, argv, 3, 4096);
+        const double           ratio = argc > 4 ? std::stod(argv[4]) : 0.0;
+        const std::string_view name  = argc > 5 ? argv[5] : "cells";
+        const uint64_t         seed  = argc > 6 ? std::stoull(argv[6]) : 0;
+
+        MazeLayout layout = MazeLayout::CELLS;
+        if (name == "nibbles") layout = MazeLayout::NIBBLES;
+        if (name == "frozen") layout = MazeLayout::FROZEN;
+
+        AbstractMazeGenerator::seed_random(seed);
+        std::mt19937_64 rng{ 0x5EED };
+        Maze2D          maze = generate_maze(0, size);
+        braid_maze(maze, ratio, rng);
+
+        // Braiding is not recorded, so a braided maze cannot be rebuilt from the generator & seed
+        const MazeFileInfo info  = ratio > 0.0 ? MazeFileInfo{} : MazeFileInfo{ 0, seed };
+        const auto         start = Clock::now();
+        write_maze_file(maze, path, layout, info);
+        std::cout << std::format("{} x {}  wrote '{}' ({}) in {:.2f} ms\n", size, size, path,
+                                 layout_name(layout), elapsed_ms(start));
+        return 0;
+    }
+
+    // usage: inspect-file <path>; maps the file & counts its walls through the zero copy view
+    static int inspect_file(int argc, char** argv) {
+        if (argc < 3) return print_usage();
+
+        const auto           open_start = Clock::now();
+        const MappedMazeFile file{ argv[2] };
+        const double         open_ms    = elapsed_ms(open_start);
+
+        const MazeFileHeader& header = file.get_header();
+        std::cout << std::format(
+                "'{}'  version {}  {} x {}  layout {}  generator {}  seed {}"
+                "  payload {} B at {}  opened in {:.3f} ms\n",
+                argv[2], header.version, header.rows, header.cols, layout_name(file.get_layout()),
+                static_cast<int32_t>(header.generator), header.seed, header.payload_bytes,
+                header.payload_offset, open_ms
+        );
+
+        size_t     walls      = 0;
+        const auto walk_start = Clock::now();
+        file.get_file().advise(MappedFile::Access::SEQUENTIAL);
+        switch (file.get_layout()) {
+            case MazeLayout::CELLS:
+                file.get_view().for_each_wall_unique([&](Cardinal, Index2D, Cell) { ++walls; });
+                break;
+            case MazeLayout::FROZEN:
+                file.get_frozen_view().for_each_wall_unique([&](Cardinal, Index2D) { ++walls; });
+                break;
+            case MazeLayout::NIBBLES: {
+                const Index2D bounds = file.get_bounds();
+                for (Index row = 0; row < bounds.row; ++row) {
+                    for (Index col = 0; col < bounds.col; ++col) {
+                        const uint8_t openings = file.get_openings(Index2D{ row, col });
+                        walls += (row == 0) + (col == 0) + ((openings & 2U) == 0)
+                                 + ((openings & 4U) == 0);
+                    }
+                }
+                break;
+            }
+        }
+        std::cout << std::format("walls {}  walked in {:.2f} ms\n", walls, elapsed_ms(walk_start));
+        return 0;
+    }
+
+    // Number of readers (of check_maze_file, mapped, paged & tiled) which accepted the bytes
+    static int count_accepting_readers(const std::vector<uint8_t>& bytes, const std::string& path) {
+        {
+            std::ofstream out{ path, std::ios::binary | std::ios::trunc };
+            out.write(reinterpret_cast<const char*>(bytes.data()),
+                      static_cast<std::streamsize>(bytes.size()));
+        }
+
+        const auto accepts = [](auto&& open) {
+            try {
+                open();
+                return 1;
+            } catch (const std::exception&) {
+                return 0;
+            }
+        };
+
+        return accepts([&]() { check_maze_file(bytes.data(), bytes.size()); })
+               + accepts([&]() { const MappedMazeFile file{ path }; })
+               + accepts([&]() { const PagedMazeFile file{ path }; })
+               + accepts([&]() { const TiledMaze2D maze{ path }; });
+    }
+
+    // usage: check-files [dir=.]; forged & truncated maze file headers must be rejected by every
+    // reader, exits non-zero otherwise
+    static int check_files(int argc, char** argv) {
+        const std::string path = std::string{ argc > 2 ? argv[2] : "." } + "/check-files.maze";
+        const Index2D     bounds{ 4, 4 };
+
+        const MazeFileHeader valid = make_maze_file_header(bounds, MazeLayout::CELLS, {});
+        const auto           file  = [&](const MazeFileHeader& header, const size_t size) {
+            std::vector<uint8_t> bytes(size, 0);
+            std::memcpy(bytes.data(), &header, std::min(size, sizeof(MazeFileHeader)));
+            return bytes;
+        };
+        const size_t full = valid.payload_offset + valid.payload_bytes;
+
+        MazeFileHeader wrapped = valid;
+        wrapped.payload_offset = UINT64_MAX - (s_MazeFileAlignment - 1);
+
+        MazeFileHeader past_end = valid;
+        past_end.payload_offset = full + s_MazeFileAlignment;
+
+        MazeFileHeader wrong_size = valid;
+        wrong_size.payload_bytes += 1;
+
+        const std::array<std::pair<const char*, std::vector<uint8_t>>, 5> forged{ {
+                { "payload offset wraps", file(wrapped, full) },
+                { "payload offset past the end", file(past_end, full) },
+                { "payload size mismatch", file(wrong_size, full) },
+                { "payload truncated", file(valid, full - 1) },
+                { "header truncated", file(valid, sizeof(MazeFileHeader) / 2) }
+        } };
+
+        int failures = 0;
+        if (count_accepting_readers(file(valid, full), path) != 4) {
+            std::cout << "valid file: rejected\n";
+            ++failures;
+        }
+
+        for (const auto& [name, bytes] : forged) {
+            const int accepted = count_accepting_readers(bytes, path);
+            std::cout << std::format("{}: {}\n", name, accepted == 0 ? "rejected" : "ACCEPTED");
+            failures += accepted != 0;
+        }
+
+        std::filesystem::remove(path);
+        std::cout << std::format("{} failures\n", failures);
+        return failures == 0 ? 0 : 1;
+    }
+
+    template<class Source>
+    static int follow_file(Source& source, const std::string& out_path) {
+        std::ofstream                 out{ out_path, std::ios::binary | std::ios::trunc };
+        DirectionStreamWriter         writer{ out };
+        StreamingWallFollower<Source> follower{ source };
+
+        const Index2D goal  = source.get_bounds() - Index2D{ 1, 1 };
+        const auto    start = Clock::now();
+        const bool    found = follower.solve(Index2D{ 0, 0 }, goal, writer);
+        writer.finish();
+
+        std::cout << std::format(
+                "{} x {}  solved: {}  moves: {}  stream: {:.2f} MiB  {:.2f} ms"
+                "  source state: {} B\n",
+                source.get_bounds().row, source.get_bounds().col, found, follower.get_move_count(),
+                writer.get_byte_count() / (1024.0 * 1024.0), elapsed_ms(start),
+                source.get_state_bytes()
+        );
+        return found ? 0 : 2;
+    }
+
+    // usage: follow-file <path> [mapped|paged] [out=path.walk]
+    static int follow_file(int argc, char** argv) {
+        if (argc < 3) return print_usage();
+        const std::string      path     = argv[2];
+        const std::string_view mode     = argc > 3 ? argv[3] : "mapped";
+        const std::string      out_path = argc > 4 ? argv[4] : path + ".walk";
+
+        if (mode == "paged") {
+            PagedMazeFile source{ path };
+            const int     result = follow_file(source, out_path);
+            std::cout << std::format("page reads: {}\n", source.get_page_reads());
+            return result;
+        }
+
+        // Drop behind & read ahead; the walk only ever touches a few neighbouring rows at once
+        MappedMazeFile source{ path };
+        source.get_file().advise(MappedFile::Access::SEQUENTIAL);
+        return follow_file(source, out_path);
+    }
+
+    //############################################################################//
+    // | ENTRY |
+    //############################################################################//
+
+    static int print_usage() {
+        std::cout << "usage: MazeTools <command> [args...]\n"
+                     "  bench-solvers [min_size] [max_size] [braid_ratio]\n"
+                     "  bench-race [size] [braid_ratio]\n"
+                     "  bench-cache [size] [queries] [distinct]\n"
+                     "  bench-distance [min_size] [max_size] [braid_ratio]\n"
+                     "  bench-junction [size] [queries] [braid_ratio]\n"
+                     "  bench-lca [size] [queries]\n"
+                     "  bench-hpa [size] [queries] [braid_ratio] [cluster_size]\n"
+                     "  bench-dynamic [size] [changes]\n"
+                     "  bench-weighted [size] [max_cost] [braid_ratio]\n"
+                     "  bench-flow [size] [agents] [changes]\n"
+                     "  bench-validate [size]\n"
+                     "  validate-file <path>\n"
+                     "  bench-stats [size] [generator] [braid_ratio]\n"
+                     "  stats-file <path>\n"
+                     "  bias-study [size] [mazes] [generator] [seed]\n"
+                     "  bench-graph [size] [braid_ratio] [walk_steps]\n"
+                     "  bench-tiles [size] [tile]\n"
+                     "  bench-walls [size] [braid_ratio]\n"
+                     "  bench-freeze [size] [braid_ratio] [path]\n"
+                     "  build-tiled <path> [size] [tile] [budget_mib] [seed]\n"
+                     "  export-maze <path> [size] [braid_ratio] [cells|nibbles|frozen] [seed]\n"
+                     "  inspect-file <path>\n"
+                     "  check-files [dir]\n"
+                     "  follow-file <path> [mapped|paged] [out]\n";
+        return 1;
+    }
+
+} // maze::tools
+
+int main(int argc, char** argv) {
+    using namespace maze::tools;
+    if (argc < 2) return print_usage();
+
+    const std::string_view command{ argv[1] };
+    if (command == "bench-solvers") return bench_solvers(argc, argv);
+    if (command == "bench-race") return bench_race(argc, argv);
+    if (command == "bench-cache") return bench_cache(argc, argv);
+    if (command == "bench-distance") return bench_distance(argc, argv);
+    if (command == "bench-junction") return bench_junction(argc, argv);
+    if (command == "bench-lca") return bench_lca(argc, argv);
+    if (command == "bench-hpa") return bench_hpa(argc, argv);
+    if (command == "bench-dynamic") return bench_dynamic(argc, argv);
+    if (command == "bench-weighted") return bench_weighted(argc, argv);
+    if (command == "bench-flow") return bench_flow(argc, argv);
+    if (command == "bench-validate") return bench_validate(argc, argv);
+    if (command == "validate-file") return validate_file(argc, argv);
+    if (command == "bench-stats") return bench_stats(argc, argv);
+    if (command == "stats-file") return stats_file(argc, argv);
+    if (command == "bias-study") return bias_study(argc, argv);
+    if (command == "bench-graph") return bench_graph(argc, argv);
+    if (command == "bench-tiles") return bench_tiles(argc, argv);
+    if (command == "bench-walls") return bench_walls(argc, argv);
+    if (command == "bench-freeze") return bench_freeze(argc, argv);
+    if (command == "build-tiled") return build_tiled(argc, argv);
+    if (command == "export-maze") return export_maze(argc, argv);
+    if (command == "inspect-file") return inspect_file(argc, argv);
+    if (command == "check-files") return check_files(argc, argv);
+    if (command == "follow-file") return follow_file(argc, argv);
+
+    return print_usage();
+}
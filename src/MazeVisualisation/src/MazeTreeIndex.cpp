@@ -0,0 +1,219 @@
+//
+// Header File: MazeTreeIndex.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeTreeIndex.h"
+
+namespace maze {
+
+    LcaIndex::LcaIndex(
+    ) : m_Bounds{ 0, 0 },
+        m_Root(0),
+        m_Parents(),
+        m_Depths(),
+        m_First(),
+        m_Last(),
+        m_Euler(),
+        m_BlockMasks(),
+        m_SparseTable() {
+    }
+
+    //############################################################################//
+    // | CONSTRUCTION |
+    //############################################################################//
+
+    void LcaIndex::build(const Maze2D& maze, const Index2D root) {
+        maze.check_index(root);
+        m_Bounds = maze.get_bounds();
+        m_Root   = root.flat(m_Bounds.col);
+
+        build_euler_tour(maze);
+        build_range_min();
+
+        HINFO("[LCA_INDEX]", " # Cells: {}, Euler: {}, Blocks: {}, Levels: {}",
+              maze.get_size(), m_Euler.size(), m_BlockMasks.size() / s_BlockSize,
+              m_SparseTable.size()
+        );
+    }
+
+    void LcaIndex::build_euler_tour(const Maze2D& maze) {
+        const size_t cells = maze.get_size();
+        m_Parents.resize(cells);
+        m_Depths.assign(cells, s_Unreachable);
+        m_First.assign(cells, s_Unreachable);
+        m_Last.assign(cells, s_Unreachable);
+        m_Euler.clear();
+        m_Euler.reserve(cells * 2 - 1);
+
+        struct Frame {
+            Index   cell;
+            uint8_t next_dir;
+        };
+
+        const auto enter = [&](const Index cell) {
+            m_First[cell] = m_Last[cell] = static_cast<uint32_t>(m_Euler.size());
+            m_Euler.push_back(cell);
+        };
+
+        // Iterative DFS; every return to a cell appends it to the tour again
+        std::vector<Frame> stack{};
+        m_Depths[m_Root] = 0;
+        enter(m_Root);
+        stack.push_back(Frame{ m_Root, 0 });
+
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            if (frame.next_dir == s_CardinalCount) {
+                stack.pop_back();
+                if (!stack.empty()) {
+                    const Index parent = stack.back().cell;
+                    m_Last[parent] = static_cast<uint32_t>(m_Euler.size());
+                    m_Euler.push_back(parent);
+                }
+                continue;
+            }
+
+            const Index    cell = frame.cell;
+            const Cardinal dir  = static_cast<Cardinal>(frame.next_dir++);
+            if (cell != m_Root && m_Parents.get(cell) == dir) continue;
+
+            const Index2D pos{ cell / m_Bounds.col, cell % m_Bounds.col };
+            if (is_wall(dir, maze.get_cell(pos)) || !maze.inbounds(pos, dir)) continue;
+
+            const Index next = cell + flat_offset(dir, m_Bounds.col);
+
+            if (m_First[next] != s_Unreachable) {
+                HERR("[LCA_INDEX]", " # Maze contains a loop at cell {}; it is not a tree.", next);
+                throw std::exception();
+            }
+
+            m_Parents.set(next, opposite(dir));
+            m_Depths[next] = m_Depths[cell] + 1;
+            enter(next);
+            stack.push_back(Frame{ next, 0 });
+        }
+    }
+
+    void LcaIndex::build_range_min() {
+        const uint32_t size   = static_cast<uint32_t>(m_Euler.size());
+        const uint32_t blocks = (size + s_BlockSize - 1) / s_BlockSize;
+        m_BlockMasks.assign(size, 0);
+
+        // In-block; bit j of mask[i] is set if position j is on the (increasing depth) stack of
+        // suffix minima ending at i, the lowest set bit at or after 'first' is the minimum.
+        std::vector<uint32_t> block_min(blocks);
+        for (uint32_t block = 0; block < blocks; ++block) {
+            const uint32_t begin = block * s_BlockSize;
+            const uint32_t end   = std::min(size, begin + s_BlockSize);
+            uint64_t       stack = 0;
+
+            for (uint32_t i = begin; i < end; ++i) {
+                const uint32_t depth = m_Depths[m_Euler[i]];
+                while (stack != 0) {
+                    const uint32_t top = begin + 63 - std::countl_zero(stack);
+                    if (m_Depths[m_Euler[top]] < depth) break;
+                    stack &= ~(1ULL << (top - begin));
+                }
+                stack |= 1ULL << (i - begin);
+                m_BlockMasks[i] = stack;
+            }
+            block_min[block] = begin + std::countr_zero(m_BlockMasks[end - 1]);
+        }
+
+        // Sparse table over the block minima; level k covers 2^k blocks
+        m_SparseTable.clear();
+        m_SparseTable.push_back(std::move(block_min));
+        for (uint32_t width = 2; width <= blocks; width *= 2) {
+            const std::vector<uint32_t>& prev = m_SparseTable.back();
+            std::vector<uint32_t>        level(blocks - width + 1);
+            for (uint32_t i = 0; i < level.size(); ++i) {
+                level[i] = shallower(prev[i], prev[i + width / 2]);
+            }
+            m_SparseTable.push_back(std::move(level));
+        }
+    }
+
+    //############################################################################//
+    // | QUERIES |
+    //############################################################################//
+
+    uint32_t LcaIndex::range_argmin(uint32_t first, uint32_t last) const {
+        if (first > last) std::swap(first, last);
+
+        const uint32_t first_block = first / s_BlockSize;
+        const uint32_t last_block  = last / s_BlockSize;
+        if (first_block == last_block) return block_argmin(first, last);
+
+        uint32_t best = shallower(
+                block_argmin(first, first_block * s_BlockSize + s_BlockSize - 1),
+                block_argmin(last_block * s_BlockSize, last)
+        );
+
+        if (last_block - first_block > 1) {
+            const uint32_t lo    = first_block + 1;
+            const uint32_t hi    = last_block - 1;
+            const uint32_t level = 31 - std::countl_zero(hi - lo + 1);
+            const auto&    table = m_SparseTable[level];
+            best = shallower(best, shallower(table[lo], table[hi + 1 - (1U << level)]));
+        }
+        return best;
+    }
+
+    Index LcaIndex::lca(const Index a, const Index b) const {
+        return m_Euler[range_argmin(m_First[a], m_First[b])];
+    }
+
+    uint32_t LcaIndex::distance(const Index a, const Index b) const {
+        if (!is_reachable(a) || !is_reachable(b)) return s_Unreachable;
+        return m_Depths[a] + m_Depths[b] - 2 * m_Depths[lca(a, b)];
+    }
+
+    std::optional<Cardinal> LcaIndex::next_step(const Index from, const Index to) const {
+        if (from == to || !is_reachable(from) || !is_reachable(to)) return std::nullopt;
+
+        // Heading up towards the common ancestor
+        if (lca(from, to) != from) return m_Parents.get(from);
+
+        // Heading down; the child whose Euler interval holds 'to'
+        const Index2D pos{ from / m_Bounds.col, from % m_Bounds.col };
+        for (const Cardinal dir : s_AllCardinals) {
+            if (!(pos + cardinal_offset(dir)).inbounds(m_Bounds)) continue;
+
+            const Index child = from + flat_offset(dir, m_Bounds.col);
+            if (child == m_Root || !is_reachable(child)) continue;
+            if (m_Parents.get(child) != opposite(dir)) continue;
+            if (m_First[child] <= m_First[to] && m_First[to] <= m_Last[child]) return dir;
+        }
+        return std::nullopt;
+    }
+
+    std::vector<Index> LcaIndex::path(const Index from, const Index to) const {
+        std::vector<Index> cells{};
+        if (!is_reachable(from) || !is_reachable(to)) return cells;
+
+        // Climb from both ends to the common ancestor, the second half is reversed
+        const Index ancestor = lca(from, to);
+        for (Index cell = from; cell != ancestor; cell = parent_of(cell)) cells.push_back(cell);
+        cells.push_back(ancestor);
+
+        const size_t split = cells.size();
+        for (Index cell = to; cell != ancestor; cell = parent_of(cell)) cells.push_back(cell);
+        std::reverse(cells.begin() + split, cells.end());
+        return cells;
+    }
+
+    size_t LcaIndex::get_state_bytes() const {
+        size_t table = 0;
+        for (const auto& level : m_SparseTable) table += level.capacity() * sizeof(uint32_t);
+
+        return m_Parents.get_bytes()
+               + (m_Depths.capacity() + m_First.capacity() + m_Last.capacity()) * sizeof(uint32_t)
+               + m_Euler.capacity() * sizeof(Index)
+               + m_BlockMasks.capacity() * sizeof(uint64_t)
+               + table;
+    }
+
+} // maze
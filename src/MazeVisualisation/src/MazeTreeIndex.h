@@ -0,0 +1,105 @@
+//
+// Header File: MazeTreeIndex.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZETREEINDEX_H
+#define MAZEVISUALISATION_MAZETREEINDEX_H
+
+#include "MazeConstructs.h"
+#include "MazeSolvers.h"
+
+#include <optional>
+
+namespace maze {
+
+    //############################################################################//
+    // | LOWEST COMMON ANCESTOR INDEX |
+    //############################################################################//
+
+    // Treats a perfect maze as a tree rooted at a cell and answers distance & next step queries
+    // in O(1) via the lowest common ancestor; depth(a) + depth(b) - 2 * depth(lca). The LCA is a
+    // range minimum over the Euler tour (by depth) which uses 64 bit in-block stack masks and a
+    // sparse table over the block minima, so memory stays linear in the cell count.
+    //
+    // Building fails (throws) if the maze contains a loop; cells not connected to the root are
+    // reported as unreachable.
+    class LcaIndex {
+
+    public:
+        inline static constexpr uint32_t s_Unreachable = UINT32_MAX;
+        inline static constexpr uint32_t s_BlockSize   = 64;
+
+    private:
+        Index2D                            m_Bounds;
+        Index                              m_Root;
+        DirectionPlane                     m_Parents;
+        std::vector<uint32_t>              m_Depths;
+        std::vector<uint32_t>              m_First;
+        std::vector<uint32_t>              m_Last;
+        std::vector<Index>                 m_Euler;
+        std::vector<uint64_t>              m_BlockMasks;
+        std::vector<std::vector<uint32_t>> m_SparseTable;
+
+    public:
+        LcaIndex();
+
+    public:
+        void build(const Maze2D& maze, Index2D root = Index2D{ 0, 0 });
+
+        bool is_reachable(const Index flat) const {
+            return m_First[flat] != s_Unreachable;
+        }
+
+        uint32_t get_depth(const Index flat) const {
+            return m_Depths[flat];
+        }
+
+        Index get_root() const {
+            return m_Root;
+        }
+
+        size_t get_state_bytes() const;
+
+        // Lowest common ancestor of two reachable cells
+        Index lca(Index a, Index b) const;
+
+        // Steps between the two cells; s_Unreachable if either is unreachable
+        uint32_t distance(Index a, Index b) const;
+
+        uint32_t distance(const Index2D a, const Index2D b) const {
+            return distance(a.flat(m_Bounds.col), b.flat(m_Bounds.col));
+        }
+
+        // Direction of the first step on the path from 'from' to 'to'
+        std::optional<Cardinal> next_step(Index from, Index to) const;
+
+        // Flat cells from 'from' to 'to' (inclusive); empty if unreachable
+        std::vector<Index> path(Index from, Index to) const;
+
+    private:
+        Index parent_of(const Index flat) const {
+            return flat + flat_offset(m_Parents.get(flat), m_Bounds.col);
+        }
+
+        // Position in the Euler tour with the smaller depth
+        uint32_t shallower(const uint32_t i, const uint32_t j) const {
+            return m_Depths[m_Euler[j]] < m_Depths[m_Euler[i]] ? j : i;
+        }
+
+        uint32_t block_argmin(const uint32_t first, const uint32_t last) const {
+            const uint32_t offset = first % s_BlockSize;
+            return first - offset + std::countr_zero(m_BlockMasks[last] & (~0ULL << offset));
+        }
+
+        uint32_t range_argmin(uint32_t first, uint32_t last) const;
+
+        void build_euler_tour(const Maze2D& maze);
+        void build_range_min();
+    };
+
+} // maze
+
+#endif
@@ -0,0 +1,320 @@
+//
+// Header File: MazeView.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEVIEW_H
+#define MAZEVISUALISATION_MAZEVIEW_H
+
+#include "MazeConstructs.h"
+
+#include <atomic>
+#include <type_traits>
+
+namespace maze {
+
+    //############################################################################//
+    // | MAZE VIEW |
+    //############################################################################//
+
+    // Non-owning rectangle of a Maze2D: origin & extent in maze cells, the row stride and a
+    // pointer to the origin cell. Positions given to & passed back from a view are relative to
+    // its origin and everything is clipped to the rectangle; neighbours outside it read as
+    // INVALID and a path may only be made between two cells inside it. Threads may therefore
+    // write through views of disjoint rectangles of the same maze at once.
+    //
+    // Cells are only written through 'set_flags', 'unset_flags' & 'make_path', which keep the
+    // maze's wall hash current with an atomic XOR, but listeners are not told; call 'notify_reset'
+    // on the maze once done if any are attached. The maze itself must not be modified or resized
+    // while a view of it is in use.
+    template<bool IsConst>
+    class BasicMazeView {
+
+        template<bool>
+        friend class BasicMazeView;
+
+    public:
+        using CellPtr = std::conditional_t<IsConst, const Cell*, Cell*>;
+        using MazeRef = std::conditional_t<IsConst, const Maze2D&, Maze2D&>;
+
+    private:
+        Index2D   m_Origin;
+        Index2D   m_Extent;
+        Index     m_Stride;
+        CellPtr   m_Cells;
+        uint64_t* m_WallHash;
+
+    public:
+        explicit BasicMazeView(
+                MazeRef maze
+        ) : BasicMazeView(maze, Index2D{ 0, 0 }, maze.get_bounds()) {
+        }
+
+        // The rectangle is clipped to the maze & may end up empty
+        BasicMazeView(
+                MazeRef maze,
+                const Index2D origin,
+                const Index2D extent
+        ) : m_Origin(clip(origin, maze.get_bounds())),
+            m_Extent(clip_extent(m_Origin, origin + extent, maze.get_bounds())),
+            m_Stride(maze.get_col_count()),
+            m_Cells(maze.m_Cells.data() + first_cell(m_Origin, m_Extent, m_Stride)),
+            m_WallHash(hash_of(maze)) {
+        }
+
+        // Read only view of row major cells held elsewhere, e.g. a mapped maze file
+        BasicMazeView(
+                const Cell* cells,
+                const Index2D bounds
+        ) requires IsConst
+                : m_Origin{ 0, 0 },
+                  m_Extent(bounds),
+                  m_Stride(bounds.col),
+                  m_Cells(cells),
+                  m_WallHash(nullptr) {
+        }
+
+        // Writable views convert to read only ones
+        BasicMazeView(const BasicMazeView<false>& view) requires IsConst
+                : m_Origin(view.m_Origin),
+                  m_Extent(view.m_Extent),
+                  m_Stride(view.m_Stride),
+                  m_Cells(view.m_Cells),
+                  m_WallHash(nullptr) {
+        }
+
+    private:
+        BasicMazeView(
+                const Index2D origin,
+                const Index2D extent,
+                const Index stride,
+                const CellPtr cells,
+                uint64_t* wall_hash
+        ) : m_Origin(origin),
+            m_Extent(extent),
+            m_Stride(stride),
+            m_Cells(cells),
+            m_WallHash(wall_hash) {
+        }
+
+        //############################################################################//
+        // | GETTERS |
+        //############################################################################//
+
+    public:
+        // Rectangle of this view (relative to it) clipped to it
+        BasicMazeView subview(const Index2D origin, const Index2D extent) const {
+            const Index2D begin = clip(origin, m_Extent);
+            const Index2D size  = clip_extent(begin, origin + extent, m_Extent);
+            return BasicMazeView{
+                    m_Origin + begin,
+                    size,
+                    m_Stride,
+                    m_Cells + first_cell(begin, size, m_Stride),
+                    m_WallHash
+            };
+        }
+
+        // Position of the origin in the maze
+        Index2D get_origin() const {
+            return m_Origin;
+        }
+
+        Index2D get_extent() const {
+            return m_Extent;
+        }
+
+        Index get_row_count() const {
+            return m_Extent.row;
+        }
+
+        Index get_col_count() const {
+            return m_Extent.col;
+        }
+
+        size_t get_size() const {
+            return m_Extent.size();
+        }
+
+        bool is_empty() const {
+            return m_Extent.row == 0 || m_Extent.col == 0;
+        }
+
+        // Cells between the starts of two rows (the maze's column count)
+        Index get_stride() const {
+            return m_Stride;
+        }
+
+        // The first cell of a row; the row holds 'get_col_count' cells
+        CellPtr get_row_data(const Index row) const {
+            return m_Cells + static_cast<ptrdiff_t>(row) * m_Stride;
+        }
+
+        Index2D to_maze_index(const Index2D pos) const {
+            return m_Origin + pos;
+        }
+
+        bool inbounds(const Index2D pos) const {
+            return pos.inbounds(m_Extent);
+        }
+
+        bool inbounds(const Index2D pos, const Cardinal dir) const {
+            return (pos + cardinal_offset(dir)).inbounds(m_Extent);
+        }
+
+        Cell get_cell(const Index2D pos) const {
+            check_index(pos);
+            return m_Cells[offset(pos)];
+        }
+
+        AdjacentCells get_adjacent(const Index2D pos) const {
+            AdjacentCells cells{};
+            for (const Cardinal dir : s_AllCardinals) {
+                if (inbounds(pos, dir)) {
+                    cells.set(dir, m_Cells[offset(pos + cardinal_offset(dir))]);
+                }
+            }
+            return cells;
+        }
+
+        template<class Function>
+        void for_each_cell(Function fn) const {
+            for (Index row = 0; row < m_Extent.row; ++row) {
+                const CellPtr line = get_row_data(row);
+                for (Index col = 0; col < m_Extent.col; ++col) {
+                    fn(Index2D{ row, col }, line[col]);
+                }
+            }
+        }
+
+        // The walls Maze2D::for_each_wall_unique reports for cells inside this view; views that
+        // tile a maze report every wall of it exactly once between them
+        template<class Function>
+        void for_each_wall_unique(Function fn) const {
+            return for_each_cell([&](const Index2D& pos, Cell cell) {
+                if (m_Origin.row + pos.row == 0 && !is_set<Flag::PATH_NORTH>(cell)) {
+                    fn(Cardinal::NORTH, pos, cell);
+                }
+
+                if (m_Origin.col + pos.col == 0 && !is_set<Flag::PATH_WEST>(cell)) {
+                    fn(Cardinal::WEST, pos, cell);
+                }
+
+                if (!is_set<Flag::PATH_EAST>(cell)) fn(Cardinal::EAST, pos, cell);
+                if (!is_set<Flag::PATH_SOUTH>(cell)) fn(Cardinal::SOUTH, pos, cell);
+            });
+        }
+
+        //############################################################################//
+        // | WRITES |
+        //############################################################################//
+
+    public:
+        void set_flags(const Index2D pos, std::initializer_list<Flag> flags) requires (!IsConst) {
+            check_index(pos);
+            Cell&      cell   = m_Cells[offset(pos)];
+            const Cell before = cell;
+            for (const Flag flag : flags) cell |= cellof(flag);
+            update_hash(pos, before, cell);
+        }
+
+        void unset_flags(const Index2D pos, std::initializer_list<Flag> flags) requires (!IsConst) {
+            check_index(pos);
+            Cell&      cell   = m_Cells[offset(pos)];
+            const Cell before = cell;
+            for (const Flag flag : flags) cell &= ~cellof(flag);
+            update_hash(pos, before, cell);
+        }
+
+        // Both cells must be inside the view
+        void make_path(const Index2D pos, const Cardinal dir) requires (!IsConst) {
+            const Index2D to_pos = pos + cardinal_offset(dir);
+            check_index(pos);
+            check_index(to_pos);
+
+            Cell&      from        = m_Cells[offset(pos)];
+            Cell&      to          = m_Cells[offset(to_pos)];
+            const Cell from_before = from;
+            const Cell to_before   = to;
+
+            from = (from & ~cellof<Flag::EMPTY_PATH>()) | path_bit(dir);
+            to   = (to & ~cellof<Flag::EMPTY_PATH>()) | path_bit(opposite(dir));
+
+            update_hash(pos, from_before, from);
+            update_hash(to_pos, to_before, to);
+        }
+
+        //############################################################################//
+        // | UTILITY |
+        //############################################################################//
+
+    private:
+        static Index2D clip(const Index2D pos, const Index2D bounds) {
+            return Index2D{
+                    std::clamp(pos.row, 0, bounds.row),
+                    std::clamp(pos.col, 0, bounds.col)
+            };
+        }
+
+        static Index2D clip_extent(const Index2D begin, const Index2D end, const Index2D bounds) {
+            const Index2D clipped = clip(end, bounds);
+            return Index2D{
+                    std::max(0, clipped.row - begin.row),
+                    std::max(0, clipped.col - begin.col)
+            };
+        }
+
+        // Empty views point at the first cell rather than past the end
+        static ptrdiff_t first_cell(const Index2D pos, const Index2D extent, const Index stride) {
+            if (extent.row == 0 || extent.col == 0) return 0;
+            return static_cast<ptrdiff_t>(pos.row) * stride + pos.col;
+        }
+
+        static uint64_t* hash_of(MazeRef maze) {
+            if constexpr (IsConst) {
+                return nullptr;
+            } else {
+                return &maze.m_WallHash;
+            }
+        }
+
+        // PATH_NORTH .. PATH_WEST are consecutive bits in Cardinal order
+        static Cell path_bit(const Cardinal dir) {
+            return cellof<Flag::PATH_NORTH>() << static_cast<int>(dir);
+        }
+
+        ptrdiff_t offset(const Index2D pos) const {
+            return static_cast<ptrdiff_t>(pos.row) * m_Stride + pos.col;
+        }
+
+        void check_index(const Index2D pos) const {
+            if (!inbounds(pos)) {
+                HERR(
+                        "[MAZE_VIEW]",
+                        " # Index '{}' is out of bounds for view '{}' at '{}'...",
+                        pos.to_string(),
+                        m_Extent.to_string(),
+                        m_Origin.to_string()
+                );
+                throw std::exception();
+            }
+        }
+
+        // Views of disjoint rectangles share the one hash so the XOR is atomic
+        void update_hash(const Index2D pos, const Cell before, const Cell after) {
+            const size_t   flat = static_cast<size_t>((m_Origin + pos).flat(m_Stride));
+            const uint64_t keys = Maze2D::path_keys(flat, before, after);
+            if (keys != 0) {
+                std::atomic_ref<uint64_t>{ *m_WallHash }.fetch_xor(keys, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    using MazeView      = BasicMazeView<false>;
+    using ConstMazeView = BasicMazeView<true>;
+
+} // maze
+
+#endif
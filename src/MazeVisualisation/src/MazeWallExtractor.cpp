@@ -0,0 +1,270 @@
+//
+// Header File: MazeWallExtractor.cpp
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#include "MazeWallExtractor.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MAZE_WALLS_SSE2
+#endif
+
+namespace maze {
+
+    //############################################################################//
+    // | MASK KERNELS |
+    //############################################################################//
+
+    // Bit i is set when cells[i] has 'flag' unset, i.e. a wall on that side; count <= 64
+    static uint64_t closed_mask(const Cell* cells, const size_t count, const Cell flag) {
+        uint64_t mask = 0;
+        size_t   i    = 0;
+
+        #ifdef MAZE_WALLS_SSE2
+        const __m128i bit  = _mm_set1_epi32(static_cast<int>(flag));
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 4 <= count; i += 4) {
+            const __m128i block  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cells + i));
+            const __m128i closed = _mm_cmpeq_epi32(_mm_and_si128(block, bit), zero);
+            mask |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(closed))) << i;
+        }
+        #endif
+
+        for (; i < count; ++i) mask |= static_cast<uint64_t>((cells[i] & flag) == 0) << i;
+        return mask;
+    }
+
+    static void emit_walls(
+            uint64_t mask,
+            const Index first,
+            const Cardinal dir,
+            std::vector<uint32_t>& out
+    ) {
+        for (; mask != 0; mask &= mask - 1) {
+            out.push_back(WallExtractor::pack_wall(first + std::countr_zero(mask), dir));
+        }
+    }
+
+    // Runs of set bits along one grid line; 'open' carries the begin of a run which reached the
+    // end of the previous mask & may continue into this one (-1 if none)
+    static void emit_runs(
+            uint64_t mask,
+            const Index base,
+            const Index line,
+            Index& open,
+            std::vector<WallRun>& out
+    ) {
+        if (open >= 0 && (mask & 1U) == 0) {
+            out.push_back(WallRun{ line, open, base - open });
+            open = -1;
+        }
+
+        while (mask != 0) {
+            const int   start = std::countr_zero(mask);
+            const int   count = std::countr_one(mask >> start);
+            const Index begin = start == 0 && open >= 0 ? open : base + start;
+            open = -1;
+
+            if (start + count == static_cast<int>(WallExtractor::s_MaskBits)) {
+                open = begin;
+                return;
+            }
+            out.push_back(WallRun{ line, begin, base + start + count - begin });
+            mask &= ~uint64_t{ 0 } << (start + count);
+        }
+    }
+
+    //############################################################################//
+    // | WALL EXTRACTOR |
+    //############################################################################//
+
+    WallExtractor::WallExtractor(
+            ThreadPool& pool
+    ) : m_Pool(pool),
+        m_Bounds{ 0, 0 },
+        m_Bands(),
+        m_Walls(),
+        m_HorizontalRuns(),
+        m_VerticalRuns() {
+    }
+
+    void WallExtractor::extract(const Maze2D& maze) {
+        if (maze.get_size() > (UINT32_MAX >> 2)) {
+            HERR("[WALLS]", " # Maze with {} cells is too large to pack...", maze.get_size());
+            throw std::exception();
+        }
+
+        m_Bounds = maze.get_bounds();
+        const Index  rows       = m_Bounds.row;
+        const size_t band_count = std::clamp<size_t>(
+                static_cast<size_t>(rows) / s_MinBandRows,
+                1,
+                m_Pool.get_thread_count() * 4
+        );
+        const Index  band_rows  = static_cast<Index>((rows + band_count - 1) / band_count);
+
+        m_Bands.resize(band_count);
+        for (size_t i = 0; i < band_count; ++i) {
+            m_Bands[i].row_begin = std::min(rows, static_cast<Index>(i) * band_rows);
+            m_Bands[i].row_end   = std::min(rows, m_Bands[i].row_begin + band_rows);
+        }
+
+        m_Pool.run(band_count, [&](const size_t band) { extract_band(maze, m_Bands[band]); });
+        join_bands();
+    }
+
+    void WallExtractor::extract_band(const Maze2D& maze, Band& band) const {
+        const Cell*  data  = maze.get_cell_data();
+        const Index  cols  = m_Bounds.col;
+        const size_t words = (static_cast<size_t>(cols) + s_MaskBits - 1) / s_MaskBits;
+
+        band.walls.clear();
+        band.horizontal.clear();
+        band.vertical.clear();
+
+        // Closed east sides of the previous row & where each open vertical run started; line 0
+        // (the west edge) is tracked on its own
+        band.masks.assign(words, 0);
+        band.run_starts.resize(static_cast<size_t>(cols) + 1);
+        bool is_west_open = false;
+
+        constexpr Cell north = cellof<Flag::PATH_NORTH>();
+        constexpr Cell east  = cellof<Flag::PATH_EAST>();
+        constexpr Cell south = cellof<Flag::PATH_SOUTH>();
+
+        const auto chunk = [&](const size_t word) {
+            return std::min<size_t>(s_MaskBits, cols - word * s_MaskBits);
+        };
+
+        for (Index row = band.row_begin; row < band.row_end; ++row) {
+            const Index first = row * cols;
+            const Cell* line  = data + first;
+
+            if (row == 0) {
+                Index open = -1;
+                for (size_t word = 0; word < words; ++word) {
+                    const Index    base = static_cast<Index>(word * s_MaskBits);
+                    const uint64_t mask = closed_mask(line + base, chunk(word), north);
+                    emit_walls(mask, first + base, Cardinal::NORTH, band.walls);
+                    emit_runs(mask, base, 0, open, band.horizontal);
+                }
+                if (open >= 0) band.horizontal.push_back(WallRun{ 0, open, cols - open });
+            }
+
+            const bool is_west = is_unset<Flag::PATH_WEST>(line[0]);
+            if (is_west) band.walls.push_back(pack_wall(first, Cardinal::WEST));
+            if (is_west && !is_west_open) band.run_starts[0] = row;
+            if (!is_west && is_west_open) {
+                band.vertical.push_back(WallRun{ 0, band.run_starts[0], row - band.run_starts[0] });
+            }
+            is_west_open = is_west;
+
+            // East walls; a vertical run starts where a wall appears below an open side & ends
+            // where it disappears
+            for (size_t word = 0; word < words; ++word) {
+                const Index    base = static_cast<Index>(word * s_MaskBits);
+                const uint64_t mask = closed_mask(line + base, chunk(word), east);
+                emit_walls(mask, first + base, Cardinal::EAST, band.walls);
+
+                const uint64_t previous = band.masks[word];
+                for (uint64_t ends = previous & ~mask; ends != 0; ends &= ends - 1) {
+                    const Index run_line = base + std::countr_zero(ends) + 1;
+                    const Index begin    = band.run_starts[run_line];
+                    band.vertical.push_back(WallRun{ run_line, begin, row - begin });
+                }
+                for (uint64_t starts = mask & ~previous; starts != 0; starts &= starts - 1) {
+                    band.run_starts[base + std::countr_zero(starts) + 1] = row;
+                }
+                band.masks[word] = mask;
+            }
+
+            Index open = -1;
+            for (size_t word = 0; word < words; ++word) {
+                const Index    base = static_cast<Index>(word * s_MaskBits);
+                const uint64_t mask = closed_mask(line + base, chunk(word), south);
+                emit_walls(mask, first + base, Cardinal::SOUTH, band.walls);
+                emit_runs(mask, base, row + 1, open, band.horizontal);
+            }
+            if (open >= 0) band.horizontal.push_back(WallRun{ row + 1, open, cols - open });
+        }
+
+        // Close the vertical runs still open at the end of the band
+        const Index end = band.row_end;
+        if (is_west_open) {
+            band.vertical.push_back(WallRun{ 0, band.run_starts[0], end - band.run_starts[0] });
+        }
+        for (size_t word = 0; word < words; ++word) {
+            const Index base = static_cast<Index>(word * s_MaskBits);
+            for (uint64_t open = band.masks[word]; open != 0; open &= open - 1) {
+                const Index run_line = base + std::countr_zero(open) + 1;
+                const Index begin    = band.run_starts[run_line];
+                band.vertical.push_back(WallRun{ run_line, begin, end - begin });
+            }
+        }
+    }
+
+    void WallExtractor::join_bands() {
+        size_t wall_count       = 0;
+        size_t horizontal_count = 0;
+        for (const Band& band : m_Bands) {
+            wall_count += band.walls.size();
+            horizontal_count += band.horizontal.size();
+        }
+        m_Walls.resize(wall_count);
+        m_HorizontalRuns.resize(horizontal_count);
+
+        // Each band copies into its own slice
+        m_Pool.run(m_Bands.size(), [&](const size_t index) {
+            size_t wall_offset       = 0;
+            size_t horizontal_offset = 0;
+            for (size_t i = 0; i < index; ++i) {
+                wall_offset += m_Bands[i].walls.size();
+                horizontal_offset += m_Bands[i].horizontal.size();
+            }
+
+            const Band& band = m_Bands[index];
+            std::copy(band.walls.begin(), band.walls.end(), m_Walls.begin() + wall_offset);
+            std::copy(
+                    band.horizontal.begin(),
+                    band.horizontal.end(),
+                    m_HorizontalRuns.begin() + horizontal_offset
+            );
+        });
+
+        // Vertical runs cut by a band border continue the run of the band above which ended on
+        // the same line at that row
+        std::vector<size_t> tails(static_cast<size_t>(m_Bounds.col) + 1, SIZE_MAX);
+        m_VerticalRuns.clear();
+        for (const Band& band : m_Bands) {
+            for (const WallRun& run : band.vertical) {
+                size_t& tail = tails[run.line];
+                if (run.begin == band.row_begin && tail != SIZE_MAX) {
+                    WallRun& above = m_VerticalRuns[tail];
+                    if (above.begin + above.length == run.begin) {
+                        above.length += run.length;
+                        continue;
+                    }
+                }
+
+                if (run.begin + run.length == band.row_end) tail = m_VerticalRuns.size();
+                m_VerticalRuns.push_back(run);
+            }
+        }
+    }
+
+    size_t WallExtractor::get_state_bytes() const {
+        const size_t runs  = m_HorizontalRuns.capacity() + m_VerticalRuns.capacity();
+        size_t       bytes = m_Walls.capacity() * sizeof(uint32_t) + runs * sizeof(WallRun);
+        for (const Band& band : m_Bands) {
+            bytes += band.walls.capacity() * sizeof(uint32_t)
+                     + (band.horizontal.capacity() + band.vertical.capacity()) * sizeof(WallRun)
+                     + band.masks.capacity() * sizeof(uint64_t)
+                     + band.run_starts.capacity() * sizeof(Index);
+        }
+        return bytes;
+    }
+
+} // maze
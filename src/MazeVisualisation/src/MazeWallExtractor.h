@@ -0,0 +1,117 @@
+//
+// Header File: MazeWallExtractor.h
+// Date       : 18/10/2026
+// Project    : MazeVisualisation
+// Author     : -Ry
+//
+
+#ifndef MAZEVISUALISATION_MAZEWALLEXTRACTOR_H
+#define MAZEVISUALISATION_MAZEWALLEXTRACTOR_H
+
+#include "MazeConstructs.h"
+#include "MazeParallel.h"
+
+namespace maze {
+
+    //############################################################################//
+    // | WALL EXTRACTION |
+    //############################################################################//
+
+    // Maximal straight run of walls along a grid line. Horizontal runs lie on line 'line' between
+    // rows line - 1 & line (0 is the top edge) and cover columns [begin, begin + length);
+    // vertical runs lie between columns line - 1 & line and cover rows [begin, begin + length).
+    struct WallRun {
+        Index line;
+        Index begin;
+        Index length;
+    };
+
+    // The walls Maze2D::for_each_wall_unique reports, as flat arrays. Each wall is packed into a
+    // 32 bit word (flat index << 2 | side) ordered by row; within a row the north walls (first
+    // row only) come first, then the west wall (first column only), east walls & south walls.
+    // Straight runs of the same walls are produced alongside for consumers that merge geometry.
+    //
+    // Row bands are processed in parallel. Each row is read 64 cells at a time into bitmasks of
+    // the closed sides (SSE2 compare & movemask where available) and walls & runs are read off
+    // the masks with countr_zero / countr_one, so the cost follows the number of walls rather
+    // than branching on every side of every cell. Bands are then concatenated in parallel and
+    // vertical runs crossing band borders are joined. Buffers are kept between calls.
+    class WallExtractor {
+
+    public:
+        inline static constexpr size_t s_MinBandRows = 64;
+        inline static constexpr size_t s_MaskBits    = 64;
+
+    private:
+        struct Band {
+            Index                 row_begin;
+            Index                 row_end;
+            std::vector<uint32_t> walls;
+            std::vector<WallRun>  horizontal;
+            std::vector<WallRun>  vertical;
+            std::vector<uint64_t> masks;
+            std::vector<Index>    run_starts;
+        };
+
+    private:
+        ThreadPool&           m_Pool;
+        Index2D               m_Bounds;
+        std::vector<Band>     m_Bands;
+        std::vector<uint32_t> m_Walls;
+        std::vector<WallRun>  m_HorizontalRuns;
+        std::vector<WallRun>  m_VerticalRuns;
+
+    public:
+        explicit WallExtractor(ThreadPool& pool = ThreadPool::get_shared());
+
+    public:
+        void extract(const Maze2D& maze);
+
+        size_t get_wall_count() const {
+            return m_Walls.size();
+        }
+
+        const std::vector<uint32_t>& get_walls() const {
+            return m_Walls;
+        }
+
+        const std::vector<WallRun>& get_horizontal_runs() const {
+            return m_HorizontalRuns;
+        }
+
+        const std::vector<WallRun>& get_vertical_runs() const {
+            return m_VerticalRuns;
+        }
+
+        static uint32_t pack_wall(const Index flat, const Cardinal dir) {
+            return (static_cast<uint32_t>(flat) << 2) | static_cast<uint32_t>(dir);
+        }
+
+        static Cardinal unpack_side(const uint32_t wall) {
+            return static_cast<Cardinal>(wall & 3U);
+        }
+
+        static Index unpack_flat(const uint32_t wall) {
+            return static_cast<Index>(wall >> 2);
+        }
+
+        // fn(Cardinal, Index2D) for every wall of the last extraction
+        template<class Function>
+        void for_each_wall(Function fn) const {
+            const Index cols = m_Bounds.col;
+            for (const uint32_t wall : m_Walls) {
+                const Index flat = unpack_flat(wall);
+                fn(unpack_side(wall), Index2D{ flat / cols, flat % cols });
+            }
+        }
+
+        size_t get_state_bytes() const;
+
+    private:
+        void extract_band(const Maze2D& maze, Band& band) const;
+        void join_bands();
+    };
+
+} // maze
+
+#endif
@@ -21,14 +21,43 @@ namespace maze {
             Maze2D& maze,
             float delta
     ) {
+        Index2D player_pos = update_hit_box(app);
+
+        // If the player is out of bounds don't check for collisions
+        if (!maze.inbounds(player_pos)) return;
+        resolve_collisions(app, player_pos, maze.get_cell(player_pos));
+    }
+
+    void PlayerManager::update(
+            app::Application* app,
+            ChunkedMaze& world,
+            Index2D origin,
+            float delta
+    ) {
+        Index2D player_pos = update_hit_box(app);
+
+        // If the chunk under the player hasn't been generated yet don't check for collisions
+        std::optional<Cell> cell = world.find_cell(origin + player_pos);
+        if (!cell.has_value()) return;
+        resolve_collisions(app, player_pos, cell.value());
+    }
+
+    Index2D PlayerManager::get_player_cell(app::Application* app) {
+        const auto& cam_state = app->get_camera_state();
+        float       cx        = (cam_state.cam_pos.x / s_PlayingWallScale);
+        float       cz        = (cam_state.cam_pos.z / s_PlayingWallScale);
+        float       offset    = 0.5F;
+        return Index2D{ (Index) (cx + offset), (Index) (cz + offset) };
+    }
+
+    Index2D PlayerManager::update_hit_box(app::Application* app) {
         // Variables
         auto& cam_state = app->get_camera_state();
         cam_state.cam_pos.y = s_FixedPlayerY;
 
         // Convert Cam Position to Grid Position (Accounting for Grid Scale)
-        float cx     = (cam_state.cam_pos.x / s_PlayingWallScale);
-        float cz     = (cam_state.cam_pos.z / s_PlayingWallScale);
-        float offset = 0.5F;
+        float cx = (cam_state.cam_pos.x / s_PlayingWallScale);
+        float cz = (cam_state.cam_pos.z / s_PlayingWallScale);
         m_PlayerHitBox.realign(
                 glm::vec3{
                         cx,
@@ -37,15 +66,19 @@ namespace maze {
                 },
                 s_PlayerColliderSize
         );
-        Index2D player_pos = Index2D{ (Index) (cx + offset), (Index) (cz + offset) };
+        return get_player_cell(app);
+    }
+
+    void PlayerManager::resolve_collisions(
+            app::Application* app,
+            Index2D player_pos,
+            Cell cell
+    ) {
+        auto& cam_state = app->get_camera_state();
 
         float px = player_pos.col;
         float py = player_pos.row;
 
-        // If the player is out of bounds don't check for collisions
-        if (!maze.inbounds(player_pos)) return;
-        Cell cell = maze.get_cell(player_pos);
-
         // North, East, South, and West (Potential Colliders)
         constexpr size_t            collider_count = 4;
         app::AxisAlignedBoundingBox all_colliders[collider_count]{
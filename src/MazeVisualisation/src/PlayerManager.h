@@ -11,6 +11,7 @@
 #include "Application.h"
 #include "BoundingBox.h"
 #include "MazeConstructs.h"
+#include "MazeChunks.h"
 
 #include <glm/glm.hpp>
 
@@ -33,6 +34,16 @@ namespace maze {
 
     public:
         void update(app::Application* app, Maze2D& maze, float delta);
+
+        // Unbounded variant; the player's grid position is relative to the world origin
+        void update(app::Application* app, ChunkedMaze& world, Index2D origin, float delta);
+
+    public:
+        static Index2D get_player_cell(app::Application* app);
+
+    private:
+        Index2D update_hit_box(app::Application* app);
+        void resolve_collisions(app::Application* app, Index2D player_pos, Cell cell);
     };
 
 } // maze